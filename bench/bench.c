@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:23:37 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:47:13 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+// one pass, the closest hit of every camera ray and the shadow ray of
+// each hit, returns a sum of the hits so the modes can be compared
+static long	bench_pass(t_ctx *ctx, t_bench_mode mode)
+{
+	t_ray	rays[BENCH_ROW];
+	t_trace	c;
+	long	sum;
+	int		y;
+	int		k;
+
+	ft_bzero(&c, sizeof(c));
+	sum = 0;
+	y = 0;
+	while (y < WINDOW_HEIGHT)
+	{
+		camera_row(ctx->map, (t_int_3){0, y, BENCH_STEP}, BENCH_ROW, rays);
+		k = -1;
+		while (++k < BENCH_ROW)
+		{
+			if (bench_closest(ctx, mode, rays[k], &c))
+				sum += c.hit_id + 3 * (mode < BENCH_CAMERA
+						&& calculate_shadow(ctx, &c));
+		}
+		y += BENCH_STEP;
+	}
+	return (sum);
+}
+
+// the fastest of BENCH_RUNS passes on one core, sum = the hits of one
+static double	bench_best(t_ctx *ctx, t_bench_mode mode, long *sum)
+{
+	double	best;
+	double	t;
+	int		r;
+
+	best = INFINITY;
+	r = -1;
+	while (++r < BENCH_RUNS)
+	{
+		t = time_now();
+		*sum = bench_pass(ctx, mode);
+		best = fmin(best, time_now() - t);
+	}
+	return (best);
+}
+
+// work per ray over all the passes, a pass without shadow rays shows 0
+static void	bench_report(t_ctx *ctx, char *path, double best, long sum)
+{
+	t_tstats	*st;
+	double		sh;
+
+	st = ctx->stats;
+	sh = fmax(st->shadow_rays, 1);
+	printf("%s: %d objects, %.1f ms per %ld camera and %ld shadow rays\n",
+		path, ctx->map->num_bounded + ctx->map->pl.count, best * 1e3,
+		st->rays / BENCH_RUNS, st->shadow_rays / BENCH_RUNS);
+	printf("  %.1f nodes %.1f tests per camera ray, %.1f nodes %.1f tests "
+		"per shadow ray, hits %ld\n", st->nodes / (double)st->rays,
+		st->tests / (double)st->rays, st->shadow_nodes / sh,
+		st->shadow_tests / sh, sum);
+}
+
+// bench scene.rt [bvh|linear|camera|generic], time and work per ray
+int	main(int argc, char **argv)
+{
+	t_ctx			ctx;
+	t_tstats		st;
+	t_bench_mode	mode;
+	double			best;
+	long			sum;
+
+	if (argc < 2)
+		error_throw("usage: bench scene.rt [bvh|linear|camera|generic]");
+	mode = BENCH_BVH;
+	if (argc > 2)
+		mode = bench_mode(argv[2]);
+	ft_bzero(&ctx, sizeof(ctx));
+	ft_bzero(&st, sizeof(st));
+	ctx.map = bench_scene(argv[1], mode);
+	ctx.stats = &st;
+	ctx.occluder = -1;
+	best = bench_best(&ctx, mode, &sum);
+	bench_report(&ctx, argv[1], best, sum);
+	free_map(ctx.map);
+	return (0);
+}
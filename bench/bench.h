@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:22:41 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:47:13 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include "minirt.h"
+
+// every other pixel both ways, 327680 camera rays a pass, best of 5
+# define BENCH_STEP 2
+# define BENCH_RUNS 5
+// camera rays of one row, WINDOW_WIDTH / BENCH_STEP
+# define BENCH_ROW 640
+
+// bvh = the scene as miniRT traces it, linear = the root of the bvh made
+// one leaf of every object, so each ray tests them all in turn, camera =
+// the bvh without the shadow rays, only the closest hit queries, generic
+// = camera with every leaf object tested through the type check on its
+// own instead of the runs of one type going to the kernels
+typedef enum e_bench_mode
+{
+	BENCH_BVH,
+	BENCH_LINEAR,
+	BENCH_CAMERA,
+	BENCH_GENERIC
+}	t_bench_mode;
+
+// bench_scene.c
+t_bench_mode	bench_mode(char *name);
+t_map			*bench_scene(char *path, t_bench_mode mode);
+
+// bench_generic.c
+t_trace			*bench_closest(t_ctx *ctx, t_bench_mode mode, t_ray ray,
+					t_trace *c);
+
+#endif
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_generic.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:41:27 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:41:27 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+// the leaf object by object through the type check of intersect_primary(),
+// as the leaves were tested before the runs went to the kernels
+static void	generic_leaf(t_ctx *ctx, t_trace *closest, int *ids, int count)
+{
+	float	t;
+	int		i;
+
+	i = -1;
+	while (++i < count)
+	{
+		ctx->stats->tests++;
+		if (intersect_primary(ctx->map, closest->ray, ids[i], &t)
+			&& t < closest->t)
+			record_hit(closest, ids[i], t);
+	}
+}
+
+// bvh_closest() with generic_leaf() for the leaves
+static void	generic_bvh(t_ctx *ctx, t_ray ray, t_trace *closest)
+{
+	t_bvh_stack	st;
+	t_bvh_flat	*node;
+
+	bvh_stack_init(&st, &ray, ctx->map);
+	while (st.top > 0)
+	{
+		st.top--;
+		if (st.t[st.top] >= closest->t)
+			continue ;
+		node = &st.nodes[st.node[st.top]];
+		ctx->stats->nodes++;
+		if (node->count)
+			generic_leaf(ctx, closest, ctx->map->bounded + node->index,
+				node->count);
+		else
+			bvh_push_children(&st, st.node[st.top]);
+	}
+}
+
+// closest_obj(), or in generic mode the same search with every object of
+// a leaf dispatched on its own
+t_trace	*bench_closest(t_ctx *ctx, t_bench_mode mode, t_ray ray, t_trace *c)
+{
+	if (mode != BENCH_GENERIC)
+		return (closest_obj(ctx, ray, c));
+	closest_planes(ctx, ray, c);
+	generic_bvh(ctx, ray, c);
+	if (c->hit_id < 0)
+		return (NULL);
+	resolve_hit(ctx->map, c);
+	return (c);
+}
@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_scene.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:23:05 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:47:13 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+// bvh|linear|camera|generic, the second argument of bench
+t_bench_mode	bench_mode(char *name)
+{
+	if (!ft_strncmp(name, "bvh", 4))
+		return (BENCH_BVH);
+	if (!ft_strncmp(name, "linear", 7))
+		return (BENCH_LINEAR);
+	if (!ft_strncmp(name, "camera", 7))
+		return (BENCH_CAMERA);
+	if (!ft_strncmp(name, "generic", 8))
+		return (BENCH_GENERIC);
+	error_throw("Unknown mode, expected bvh, linear, camera or generic");
+	return (BENCH_BVH);
+}
+
+// the scene of path set up like main() does, the bvh built on one thread
+t_map	*bench_scene(char *path, t_bench_mode mode)
+{
+	t_map	*map;
+
+	map = parser(path);
+	camera_init(map);
+	map->bvh_info.split = BVH_SAH;
+	bvh_build(map, NULL);
+	scene_compile(map);
+	scene_view(map);
+	if (mode == BENCH_LINEAR && map->bvh)
+	{
+		map->bvh[0].index = 0;
+		map->bvh[0].count = map->num_bounded;
+	}
+	return (map);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gen_scene.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:22:10 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:47:13 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+// xorshift, a seed gives the same scene on every machine
+static float	rnd(unsigned int *seed, float lo, float hi)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return (lo + (hi - lo) * (*seed >> 8) / 16777216.0f);
+}
+
+// a sphere, or an upright cylinder twice as tall as it is wide for every
+// fifth object or every one of kind c, anywhere in the cube and of any
+// color, kind s makes only spheres
+static void	put_object(unsigned int *seed, int k, float dia, char kind)
+{
+	float	p[3];
+	int		col[3];
+	int		i;
+
+	i = -1;
+	while (++i < 3)
+		p[i] = rnd(seed, -40.0f, 40.0f);
+	i = -1;
+	while (++i < 3)
+		col[i] = (int)rnd(seed, 0.0f, 256.0f);
+	if (kind == 'c' || (kind != 's' && k % 5 == 0))
+		printf("cy %.2f,%.2f,%.2f 0,1,0 %.3f %.3f %d,%d,%d\n", p[0], p[1],
+			p[2], dia, 2.0f * dia, col[0], col[1], col[2]);
+	else
+		printf("sp %.2f,%.2f,%.2f %.3f %d,%d,%d\n", p[0], p[1], p[2], dia,
+			col[0], col[1], col[2]);
+}
+
+// a random scene of n spheres and cylinders in an 80 unit cube in front
+// of the camera, on stdout. the objects shrink as n grows so the cube is
+// about as full at any n, for make bench. sp or cy after the seed keeps
+// to one kind
+int	main(int argc, char **argv)
+{
+	unsigned int	seed;
+	float			dia;
+	char			kind;
+	int				n;
+	int				k;
+
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s objects [seed [sp|cy]]\n", argv[0]);
+		return (1);
+	}
+	n = atoi(argv[1]);
+	seed = 2463534242u;
+	if (argc > 2)
+		seed = (unsigned int)atoi(argv[2]) * 2654435761u | 1;
+	kind = 'm';
+	if (argc > 3)
+		kind = argv[3][0];
+	dia = 8.0f / cbrtf(n);
+	printf("A 0.2 255,255,255\nC 0,0,-60 0,0,1 70\n"
+		"L 0,40,-40 0.7 255,255,255\npl 0,-25,0 0,1,0 120,120,120\n");
+	k = -1;
+	while (++k < n)
+		put_object(&seed, k, dia, kind);
+	return (0);
+}
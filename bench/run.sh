@@ -0,0 +1,35 @@
+#!/bin/sh
+# how the cost per ray grows with the size of the scene, through the bvh
+# and testing every object, on random scenes from bench/gen_scene.
+# SIZES picks the scenes, linear stops past LINEAR_MAX objects. then the
+# closest hit queries alone on the flat bvh for CAMERA_SIZES objects. last
+# the leaves tested object by object against the runs of one type, on
+# mixed, sphere and cylinder scenes of GENERIC_SIZES objects
+set -e
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+for n in ${SIZES:-10 100 1000 10000 100000}
+do
+	./bench/gen_scene "$n" > "$dir/rand$n.rt"
+	./bench/bench "$dir/rand$n.rt" bvh | grep -v "Map OK" | grep .
+	if [ "$n" -le "${LINEAR_MAX:-1000}" ]; then
+		./bench/bench "$dir/rand$n.rt" linear | grep -v "Map OK" | grep .
+	fi
+	rm "$dir/rand$n.rt"
+done
+for n in ${CAMERA_SIZES:-10000 100000 1000000}
+do
+	./bench/gen_scene "$n" > "$dir/rand$n.rt"
+	./bench/bench "$dir/rand$n.rt" camera | grep -v "Map OK" | grep .
+	rm "$dir/rand$n.rt"
+done
+for n in ${GENERIC_SIZES:-1000 100000}
+do
+	for kind in mixed sp cy
+	do
+		./bench/gen_scene "$n" 1 "$kind" > "$dir/$kind$n.rt"
+		./bench/bench "$dir/$kind$n.rt" camera | grep -v "Map OK" | grep .
+		./bench/bench "$dir/$kind$n.rt" generic | grep -v "Map OK" | grep .
+		rm "$dir/$kind$n.rt"
+	done
+done
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bins.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:58:10 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:20:05 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// --accel bvh|bins
+t_accel	accel_by_name(char *name)
+{
+	if (!ft_strncmp(name, "bvh", 4))
+		return (ACCEL_BVH);
+	if (!ft_strncmp(name, "bins", 5))
+		return (ACCEL_BINS);
+	error_throw("Unknown accel, expected bvh or bins");
+	return (ACCEL_BVH);
+}
+
+// tiles of every bounded object, counted into start[t + 1] for each
+// tile t they cover, returns how many ids the bins hold in total
+static int	bins_count(t_win *win, t_bins *bins)
+{
+	int		*r;
+	int		total;
+	int		i;
+	int		x;
+	int		y;
+
+	ft_bzero(bins->start, (win->sched.num_tiles + 1) * sizeof(int));
+	total = 0;
+	i = -1;
+	while (++i < win->map->num_bounded)
+	{
+		r = bins->rect + 4 * i;
+		obj_tiles(win, win->map->bounded[i], r);
+		y = r[2] - 1;
+		while (++y <= r[3])
+		{
+			x = r[0] - 1;
+			while (++x <= r[1])
+				bins->start[y * win->sched.tiles_x + x + 1]++;
+			total += r[1] - r[0] + 1;
+		}
+	}
+	return (total);
+}
+
+// ids written to the slots of their tiles in bounded order, start[t]
+// moves along while tile t fills up and is put back after
+static void	bins_fill(t_win *win, t_bins *bins)
+{
+	int		*r;
+	int		i;
+	int		x;
+	int		y;
+
+	i = -1;
+	while (++i < win->map->num_bounded)
+	{
+		r = bins->rect + 4 * i;
+		y = r[2] - 1;
+		while (++y <= r[3])
+		{
+			x = r[0] - 1;
+			while (++x <= r[1])
+				bins->ids[bins->start[y * win->sched.tiles_x + x]++]
+					= win->map->bounded[i];
+		}
+	}
+	i = win->sched.num_tiles;
+	while (--i > 0)
+		bins->start[i] = bins->start[i - 1];
+	bins->start[0] = 0;
+}
+
+// sorts the spheres and cylinders into the tiles their camera rays can
+// hit them from, once per frame after the edits, the lists keep the bvh
+// leaf order so neighbouring objects still make runs for the kernels
+void	bins_build(t_win *win)
+{
+	t_bins	*bins;
+	int		total;
+	int		i;
+
+	bins = &win->bins;
+	if (!bins->start)
+	{
+		bins->start = malloc((win->sched.num_tiles + 1) * sizeof(int));
+		bins->rect = malloc((win->map->num_bounded + 1) * 4 * sizeof(int));
+		if (!bins->start || !bins->rect)
+			error_throw("Failed to allocate the tile bins");
+	}
+	total = bins_count(win, bins);
+	if (total + 1 > bins->cap)
+	{
+		free(bins->ids);
+		bins->cap = total + total / 2 + 1;
+		bins->ids = malloc(bins->cap * sizeof(int));
+		if (!bins->ids)
+			error_throw("Failed to allocate the tile bins");
+	}
+	i = 0;
+	while (++i <= win->sched.num_tiles)
+		bins->start[i] += bins->start[i - 1];
+	bins_fill(win, bins);
+}
+
+// the bin of tile for the camera rays of ctx, none with --accel bvh
+void	bins_select(t_ctx *ctx, int tile)
+{
+	t_bins	*bins;
+
+	ctx->bin = NULL;
+	if (ctx->win->opts.accel != ACCEL_BINS)
+		return ;
+	bins = &ctx->win->bins;
+	ctx->bin = bins->ids + bins->start[tile];
+	ctx->bin_count = bins->start[tile + 1] - bins->start[tile];
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bins_project.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:03:44 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:16:52 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// undoes the camera ray of camera_prepare(), p seen from the camera at
+// distance s along cam.vec is at pixel xy. 0 when p is not in front of
+// the camera, no camera ray reaches it there
+static int	project(t_map *map, t_float_3 p, float *xy)
+{
+	t_float_3	v;
+	float		s;
+
+	v = vec_sub(p, map->cam.pos);
+	s = vec_dot(v, map->cam.vec) / vec_dot(map->cam.vec, map->cam.vec);
+	if (!(s > 1e-6f))
+		return (0);
+	xy[0] = (vec_dot(v, map->vec_right) / (s * map->width) + 1.0f)
+		* (WINDOW_WIDTH / 2.0f);
+	xy[1] = (vec_dot(v, map->vec_up) / (s * map->height) + 1.0f)
+		* (WINDOW_HEIGHT / 2.0f);
+	return (isfinite(xy[0]) && isfinite(xy[1]));
+}
+
+// corner k of the box, bit 0 picks max.x, bit 1 max.y and bit 2 max.z
+static t_float_3	box_corner(t_aabb *box, int k)
+{
+	t_float_3	c;
+
+	c = box->min;
+	if (k & 1)
+		c.x = box->max.x;
+	if (k & 2)
+		c.y = box->max.y;
+	if (k & 4)
+		c.z = box->max.z;
+	return (c);
+}
+
+// pixels b[0] to b[1] of a screen size wide, grown by one for the
+// rounding of the camera rays, as tiles r[0] to r[1], none when off screen
+static void	span(float *b, int size, int tile, int *r)
+{
+	float	lo;
+	float	hi;
+
+	r[0] = 0;
+	r[1] = -1;
+	lo = floorf(b[0]) - 1.0f;
+	hi = floorf(b[1]) + 1.0f;
+	if (!(hi >= 0.0f && lo <= size - 1))
+		return ;
+	r[0] = (int)f_max(lo, 0.0f) / tile;
+	r[1] = (int)f_min(hi, size - 1) / tile;
+}
+
+// pixel bounds b = x0, x1, y0, y1 of the corners of box in front of the
+// camera, returns how many of them are
+static int	box_pixels(t_map *map, t_aabb *box, float *b)
+{
+	float	xy[2];
+	int		front;
+	int		k;
+
+	b[0] = INFINITY;
+	b[1] = -INFINITY;
+	b[2] = INFINITY;
+	b[3] = -INFINITY;
+	front = 0;
+	k = -1;
+	while (++k < 8)
+	{
+		if (!project(map, box_corner(box, k), xy))
+			continue ;
+		front++;
+		b[0] = f_min(b[0], xy[0]);
+		b[1] = f_max(b[1], xy[0]);
+		b[2] = f_min(b[2], xy[1]);
+		b[3] = f_max(b[3], xy[1]);
+	}
+	return (front);
+}
+
+// tiles r = x0, x1, y0, y1 whose camera rays can hit object id. the hull
+// of the projected corners of its box holds the projection of the box, a
+// box partly behind the camera is kept in every tile and one wholly
+// behind it in none
+void	obj_tiles(t_win *win, int id, int *r)
+{
+	t_aabb	box;
+	float	b[4];
+	int		front;
+
+	box = obj_bounds(win->map, id);
+	front = box_pixels(win->map, &box, b);
+	if (front > 0 && front < 8)
+	{
+		r[0] = 0;
+		r[1] = win->sched.tiles_x - 1;
+		r[2] = 0;
+		r[3] = win->sched.tiles_y - 1;
+		return ;
+	}
+	span(b, WINDOW_WIDTH, win->sched.tile_size, r);
+	span(b + 2, WINDOW_HEIGHT, win->sched.tile_size, r + 2);
+}
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_bounds.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:12:45 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:00:21 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+t_aabb	aabb_empty(void)
+{
+	t_aabb	box;
+
+	box.min = (t_float_3){INFINITY, INFINITY, INFINITY};
+	box.max = (t_float_3){-INFINITY, -INFINITY, -INFINITY};
+	return (box);
+}
+
+t_aabb	aabb_union(t_aabb a, t_aabb b)
+{
+	a.min.x = fminf(a.min.x, b.min.x);
+	a.min.y = fminf(a.min.y, b.min.y);
+	a.min.z = fminf(a.min.z, b.min.z);
+	a.max.x = fmaxf(a.max.x, b.max.x);
+	a.max.y = fmaxf(a.max.y, b.max.y);
+	a.max.z = fmaxf(a.max.z, b.max.z);
+	return (a);
+}
+
+t_float_3	aabb_center(t_aabb box)
+{
+	return (vec_mul(vec_add(box.min, box.max), 0.5f));
+}
+
+// bounds of a sphere or cylinder, planes are unbounded
+t_aabb	obj_bounds(t_map *map, int id)
+{
+	if ((id & OBJ_TYPE_MASK) == CYLINDER)
+		return (map->cy.box[id >> OBJ_TYPE_BITS]);
+	if ((id & OBJ_TYPE_MASK) == SPHERE)
+		return (map->sp.box[id >> OBJ_TYPE_BITS]);
+	return (aabb_empty());
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_build.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:15:59 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 13:01:04 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// size of the left half with the strategy picked with --bvh,
+// 0 when the primitives should stay together in one leaf
+int	split_range(t_bvh_build *b, t_bvh_prim *prims, int count, \
+t_aabb *box)
+{
+	if (count <= 1)
+		return (0);
+	if (b->split == BVH_SAH)
+		return (split_sah(prims, count, box));
+	if (count <= BVH_LEAF_SIZE)
+		return (0);
+	if (b->split == BVH_MEDIAN)
+		return (split_median(prims, count));
+	return (split_middle(prims, count));
+}
+
+// leaf over prims[start .. start + count], leaves point into the
+// bounded array which ends up in the same order as prims
+t_bvh_node	*bvh_new_node(t_bvh_build *b, int start, int count)
+{
+	t_bvh_node	*node;
+
+	node = malloc(sizeof(t_bvh_node));
+	if (!node)
+		error_throw("Cannot allocate bvh node");
+	node->box = range_bounds(b->prims + start, count);
+	node->left = NULL;
+	node->right = NULL;
+	node->prims = b->map->bounded + start;
+	node->count = count;
+	return (node);
+}
+
+// serial recursive build of the subtree over prims[start .. start + count]
+t_bvh_node	*build_node(t_bvh_build *b, int start, int count, int depth)
+{
+	t_bvh_node	*node;
+	int			mid;
+
+	node = bvh_new_node(b, start, count);
+	mid = 0;
+	if (depth < BVH_MAX_DEPTH - 2)
+		mid = split_range(b, b->prims + start, count, &node->box);
+	if (mid == 0)
+		return (node);
+	node->left = build_node(b, start, mid, depth + 1);
+	node->right = build_node(b, start + mid, count - mid, depth + 1);
+	node->count = 0;
+	return (node);
+}
+
+// bounds and center of every object, computed once per build
+static t_bvh_prim	*init_prims(t_map *map)
+{
+	t_bvh_prim	*prims;
+	int			i;
+
+	prims = malloc(sizeof(t_bvh_prim) * map->num_bounded);
+	if (!prims)
+		error_throw("Cannot allocate bvh primitives");
+	i = 0;
+	while (i < map->num_bounded)
+	{
+		prims[i].id = map->bounded[i];
+		prims[i].box = obj_bounds(map, map->bounded[i]);
+		prims[i].center = aabb_center(prims[i].box);
+		i++;
+	}
+	return (prims);
+}
+
+// (re)builds the bvh over the spheres and cylinders of the scene,
+// subtrees are built in parallel on the pool when one is given, the
+// tree is then flattened into map->bvh and thrown away
+void	bvh_build(t_map *map, t_pool *pool)
+{
+	t_bvh_build	b;
+	t_bvh_node	*root;
+	double		start;
+	int			i;
+
+	start = time_now();
+	collect_objects(map);
+	bvh_flat_free(map);
+	map->shape_dirty = 0;
+	if (map->num_bounded == 0)
+		return ;
+	b.map = map;
+	b.split = map->bvh_info.split;
+	b.prims = init_prims(map);
+	root = bvh_build_parallel(&b, pool);
+	i = -1;
+	while (++i < map->num_bounded)
+		map->bounded[i] = b.prims[i].id;
+	free(b.prims);
+	bvh_measure(map, root);
+	bvh_flatten(map, root);
+	bvh_free(root);
+	map->bvh_info.build_ms = (time_now() - start) * 1000.0;
+}
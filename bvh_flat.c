@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_flat.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:17:25 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 12:17:25 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// copies the subtree into map->bvh depth first from *next on, returns
+// the index its root got
+static int	flatten_node(t_map *map, t_bvh_node *node, int *next)
+{
+	int	i;
+
+	i = (*next)++;
+	map->bvh[i].box = node->box;
+	map->bvh[i].count = node->count;
+	map->bvh_types[i] = node->types;
+	if (!node->left)
+	{
+		map->bvh[i].index = node->prims - map->bounded;
+		return (i);
+	}
+	flatten_node(map, node->left, next);
+	map->bvh[i].index = flatten_node(map, node->right, next);
+	return (i);
+}
+
+// the builder works on a pointer tree, tracing and refitting on this
+// flat copy of it, bvh_measure() has counted the nodes already
+void	bvh_flatten(t_map *map, t_bvh_node *root)
+{
+	int	next;
+
+	map->bvh_nodes = map->bvh_info.nodes;
+	if (posix_memalign((void **)&map->bvh, BVH_ALIGN,
+			sizeof(t_bvh_flat) * map->bvh_nodes))
+		error_throw("Cannot allocate bvh");
+	map->bvh_types = malloc(map->bvh_nodes);
+	if (!map->bvh_types)
+		error_throw("Cannot allocate bvh");
+	next = 0;
+	flatten_node(map, root, &next);
+}
+
+void	bvh_flat_free(t_map *map)
+{
+	free(map->bvh);
+	free(map->bvh_types);
+	map->bvh = NULL;
+	map->bvh_types = NULL;
+	map->bvh_nodes = 0;
+}
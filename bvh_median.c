@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_median.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:35:23 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 11:35:23 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+static void	swap_prims(t_bvh_prim *a, t_bvh_prim *b)
+{
+	t_bvh_prim	tmp;
+
+	tmp = *a;
+	*a = *b;
+	*b = tmp;
+}
+
+// hoare partition of prims[*lo .. *hi] around the center of the range,
+// on return everything before *lo is <= pivot and everything after *hi
+// is >= pivot, equal keys are spread over both sides
+static void	hoare_step(t_bvh_prim *prims, int *lo, int *hi, int axis)
+{
+	float	pivot;
+	int		i;
+	int		j;
+
+	pivot = axis_value(prims[(*lo + *hi) / 2].center, axis);
+	i = *lo;
+	j = *hi;
+	while (i <= j)
+	{
+		while (axis_value(prims[i].center, axis) < pivot)
+			i++;
+		while (axis_value(prims[j].center, axis) > pivot)
+			j--;
+		if (i <= j)
+			swap_prims(&prims[i++], &prims[j--]);
+	}
+	*lo = i;
+	*hi = j;
+}
+
+// quickselect, the primitive with the k-th smallest center along axis
+// ends up at index k with smaller ones before and larger ones after it
+static void	select_nth(t_bvh_prim *prims, int count, int axis, int k)
+{
+	int	lo;
+	int	hi;
+	int	i;
+	int	j;
+
+	lo = 0;
+	hi = count - 1;
+	while (lo < hi)
+	{
+		i = lo;
+		j = hi;
+		hoare_step(prims, &i, &j, axis);
+		if (k <= j)
+			hi = j;
+		else if (k >= i)
+			lo = i;
+		else
+			return ;
+	}
+}
+
+// splits into two halves of equal size along the longest centroid axis,
+// the fastest split to build, never degenerate
+int	split_median(t_bvh_prim *prims, int count)
+{
+	t_aabb	cbox;
+	int		axis;
+
+	axis = centroid_bounds(prims, count, &cbox);
+	select_nth(prims, count, axis, count / 2);
+	return (count / 2);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_parallel.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:38:37 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 12:20:39 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// top of the tree, split serially until the ranges are small enough to
+// be handed out as one subtree per task, tasks fill in their slot later
+static void	build_top(t_bvh_build *b, t_bvh_node **slot, int start, \
+int count)
+{
+	t_bvh_node	*node;
+	int			mid;
+
+	if (count <= b->task_size || b->depth >= BVH_TOP_DEPTH)
+	{
+		b->tasks[b->num_tasks++] = (t_bvh_task){slot, start, count, \
+		b->depth};
+		return ;
+	}
+	node = bvh_new_node(b, start, count);
+	*slot = node;
+	mid = split_range(b, b->prims + start, count, &node->box);
+	if (mid == 0)
+		return ;
+	node->count = 0;
+	b->depth++;
+	build_top(b, &node->left, start, mid);
+	build_top(b, &node->right, start + mid, count - mid);
+	b->depth--;
+}
+
+// every worker keeps taking subtrees until none are left
+static void	build_tasks(void *arg, int id)
+{
+	t_bvh_build	*b;
+	t_bvh_task	*task;
+	int			i;
+
+	(void)id;
+	b = (t_bvh_build *)arg;
+	i = __atomic_fetch_add(&b->next_task, 1, __ATOMIC_RELAXED);
+	while (i < b->num_tasks)
+	{
+		task = &b->tasks[i];
+		*task->slot = build_node(b, task->start, task->count, task->depth);
+		i = __atomic_fetch_add(&b->next_task, 1, __ATOMIC_RELAXED);
+	}
+}
+
+// small scenes or no pool: plain serial build, otherwise the top
+// BVH_TOP_DEPTH levels are split here and the subtrees below them are
+// built by the render workers in parallel
+t_bvh_node	*bvh_build_parallel(t_bvh_build *b, t_pool *pool)
+{
+	t_bvh_node	*root;
+
+	root = NULL;
+	if (!pool || pool->count < 2 || b->map->num_bounded < BVH_PARALLEL_MIN)
+		return (build_node(b, 0, b->map->num_bounded, 0));
+	b->task_size = b->map->num_bounded / (pool->count * 4);
+	if (b->task_size < BVH_PARALLEL_MIN / 4)
+		b->task_size = BVH_PARALLEL_MIN / 4;
+	b->num_tasks = 0;
+	b->next_task = 0;
+	b->depth = 0;
+	build_top(b, &root, 0, b->map->num_bounded);
+	pool_run(pool, build_tasks, b);
+	return (root);
+}
+
+static void	refit_tasks(void *arg, int id)
+{
+	t_bvh_refit	*r;
+	int			i;
+
+	(void)id;
+	r = (t_bvh_refit *)arg;
+	i = __atomic_fetch_add(&r->next, 1, __ATOMIC_RELAXED);
+	while (i < r->count)
+	{
+		bvh_refit_range(r, r->first[i], r->end[i], r->sums[i]);
+		i = __atomic_fetch_add(&r->next, 1, __ATOMIC_RELAXED);
+	}
+}
+
+// refits the subtrees below BVH_TOP_DEPTH on the pool, then the levels
+// above them, returns the new sah cost of the tree
+float	bvh_refit_parallel(t_map *map, t_pool *pool)
+{
+	t_bvh_refit	r;
+
+	r.map = map;
+	r.types = map->shape_dirty;
+	r.total[0] = 0.0f;
+	r.total[1] = 0.0f;
+	if (!pool || pool->count < 2 || map->num_bounded < BVH_PARALLEL_MIN)
+	{
+		bvh_refit_range(&r, 0, map->bvh_nodes, r.total);
+		return (bvh_cost(&map->bvh->box, r.total));
+	}
+	r.count = 0;
+	r.next = 0;
+	r.gather = 1;
+	bvh_refit_top(&r, 0, 0, map->bvh_nodes);
+	pool_run(pool, refit_tasks, &r);
+	r.next = 0;
+	r.gather = 0;
+	bvh_refit_top(&r, 0, 0, map->bvh_nodes);
+	return (bvh_cost(&map->bvh->box, r.total));
+}
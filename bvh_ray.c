@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_ray.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:17:36 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:00:21 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// slab test, distance at which the ray enters the box (0 when it starts
+// inside), INFINITY when the box is missed or entered beyond max_t
+float	ray_box(t_ray *ray, t_float_3 inv, t_aabb *box, float max_t)
+{
+	t_float_3	t0;
+	t_float_3	t1;
+	float		near;
+	float		far;
+
+	t0.x = (box->min.x - ray->orig.x) * inv.x;
+	t1.x = (box->max.x - ray->orig.x) * inv.x;
+	t0.y = (box->min.y - ray->orig.y) * inv.y;
+	t1.y = (box->max.y - ray->orig.y) * inv.y;
+	t0.z = (box->min.z - ray->orig.z) * inv.z;
+	t1.z = (box->max.z - ray->orig.z) * inv.z;
+	near = f_max(f_max(f_min(t0.x, t1.x), f_min(t0.y, t1.y)), \
+	f_min(t0.z, t1.z));
+	far = f_min(f_min(f_max(t0.x, t1.x), f_max(t0.y, t1.y)), \
+	f_max(t0.z, t1.z));
+	near = f_max(near, 0.0f);
+	if (far < near || near > max_t)
+		return (INFINITY);
+	return (near);
+}
+
+// 1 / d, but a huge finite value for d = 0. a ray lying in the plane of a
+// box face then gets 0 * inv = 0 in the slab test instead of a nan that
+// would make it miss the box
+float	inv_dir(float d)
+{
+	if (d == 0.0f)
+		return (1e30f);
+	return (1.0f / d);
+}
+
+static void	stack_push(t_bvh_stack *st, int node, float t)
+{
+	st->node[st->top] = node;
+	st->t[st->top] = t;
+	st->top++;
+}
+
+// prepares the traversal of the bvh of map for one ray
+void	bvh_stack_init(t_bvh_stack *st, t_ray *ray, t_map *map)
+{
+	float	t;
+
+	st->ray = *ray;
+	st->inv.x = inv_dir(ray->dir.x);
+	st->inv.y = inv_dir(ray->dir.y);
+	st->inv.z = inv_dir(ray->dir.z);
+	st->nodes = map->bvh;
+	st->top = 0;
+	if (!map->bvh)
+		return ;
+	t = ray_box(&st->ray, st->inv, &map->bvh->box, INFINITY);
+	if (t < INFINITY)
+		stack_push(st, 0, t);
+}
+
+// pushes the children the ray goes through, the nearer one on top so
+// it is visited first and shrinks the search range for the other one
+void	bvh_push_children(t_bvh_stack *st, int node)
+{
+	int		right;
+	float	tl;
+	float	tr;
+
+	right = st->nodes[node].index;
+	tl = ray_box(&st->ray, st->inv, &st->nodes[node + 1].box, INFINITY);
+	tr = ray_box(&st->ray, st->inv, &st->nodes[right].box, INFINITY);
+	if (tl <= tr)
+	{
+		if (tr < INFINITY)
+			stack_push(st, right, tr);
+		if (tl < INFINITY)
+			stack_push(st, node + 1, tl);
+	}
+	else
+	{
+		if (tl < INFINITY)
+			stack_push(st, node + 1, tl);
+		if (tr < INFINITY)
+			stack_push(st, right, tr);
+	}
+}
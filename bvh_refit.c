@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_refit.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:01:15 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 13:02:41 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// new box of node i from its objects or from its two children
+static void	refit_box(t_map *map, int i)
+{
+	t_bvh_flat	*node;
+	int			*prims;
+	int			k;
+
+	node = &map->bvh[i];
+	if (node->count == 0)
+	{
+		node->box = aabb_union(map->bvh[i + 1].box, map->bvh[node->index].box);
+		return ;
+	}
+	prims = map->bounded + node->index;
+	node->box = obj_bounds(map, prims[0]);
+	k = 1;
+	while (k < node->count)
+		node->box = aabb_union(node->box, obj_bounds(map, prims[k++]));
+}
+
+// refits the nodes first .. end - 1 of a whole subtree, walking it
+// backwards visits the children before their parent. only nodes holding
+// one of the edited types are recomputed, sums as in bvh_measure()
+void	bvh_refit_range(t_bvh_refit *r, int first, int end, float *sums)
+{
+	t_bvh_flat	*node;
+
+	while (--end >= first)
+	{
+		node = &r->map->bvh[end];
+		if (r->map->bvh_types[end] & r->types)
+			refit_box(r->map, end);
+		if (node->count)
+			sums[1] += aabb_area(node->box) * node->count;
+		else
+			sums[0] += aabb_area(node->box);
+	}
+}
+
+// top BVH_TOP_DEPTH levels of a parallel refit, the gather pass lists
+// the subtrees below them for the workers, the second pass joins the
+// refitted subtrees back up to the root. end = end of the subtree
+void	bvh_refit_top(t_bvh_refit *r, int node, int depth, int end)
+{
+	t_bvh_flat	*n;
+
+	n = &r->map->bvh[node];
+	if (depth == BVH_TOP_DEPTH || n->count)
+	{
+		if (!r->gather)
+		{
+			r->total[0] += r->sums[r->next][0];
+			r->total[1] += r->sums[r->next++][1];
+			return ;
+		}
+		r->first[r->count] = node;
+		r->end[r->count] = end;
+		r->sums[r->count][0] = 0.0f;
+		r->sums[r->count++][1] = 0.0f;
+		return ;
+	}
+	bvh_refit_top(r, node + 1, depth + 1, n->index);
+	bvh_refit_top(r, n->index, depth + 1, end);
+	if (r->gather)
+		return ;
+	if (r->map->bvh_types[node] & r->types)
+		refit_box(r->map, node);
+	r->total[0] += aabb_area(n->box);
+}
+
+// expected sah cost of a ray hitting the root, sums[0] = area of all
+// inner nodes, sums[1] = area * object count of all leaves
+float	bvh_cost(t_aabb *root, float *sums)
+{
+	float	area;
+
+	area = aabb_area(*root);
+	if (area <= 0.0f)
+		return (0.0f);
+	return ((SAH_TRAVERSAL * sums[0] + SAH_INTERSECT * sums[1]) / area);
+}
+
+// brings the bvh up to date after objects moved, resized or rotated:
+// the boxes are refitted in place, which costs one pass over the edited
+// objects, and the tree is only rebuilt once the refitted cost got
+// BVH_REFIT_LIMIT times worse than right after the last build
+void	bvh_update(t_map *map, t_pool *pool)
+{
+	t_bvh_info	*info;
+	double		start;
+
+	info = &map->bvh_info;
+	if (!map->bvh)
+	{
+		bvh_build(map, pool);
+		return ;
+	}
+	start = time_now();
+	info->cost = bvh_refit_parallel(map, pool);
+	map->shape_dirty = 0;
+	info->refits++;
+	info->refit_ms = (time_now() - start) * 1000.0;
+	if (info->cost > info->built_cost * BVH_REFIT_LIMIT)
+	{
+		info->rebuilds++;
+		bvh_build(map, pool);
+	}
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_report.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:40:14 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 13:04:18 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// sums the surface areas the sah cost is made of, inner = area of every
+// inner node, leaf = area * object count of every leaf, and fills in
+// the object types below every node
+static void	measure_node(t_bvh_info *info, t_bvh_node *node, int depth, \
+float *sums)
+{
+	int	i;
+
+	if (depth > info->depth)
+		info->depth = depth;
+	info->nodes++;
+	if (!node->left)
+	{
+		info->leaves++;
+		sums[1] += aabb_area(node->box) * node->count;
+		node->types = 0;
+		i = 0;
+		while (i < node->count)
+			node->types |= 1 << (node->prims[i++] & OBJ_TYPE_MASK);
+		return ;
+	}
+	sums[0] += aabb_area(node->box);
+	measure_node(info, node->left, depth + 1, sums);
+	measure_node(info, node->right, depth + 1, sums);
+	node->types = node->left->types | node->right->types;
+}
+
+// expected cost of a ray through the tree, relative to the root area:
+// traversal steps and object tests a random ray hitting the root pays
+void	bvh_measure(t_map *map, t_bvh_node *root)
+{
+	t_bvh_info	*info;
+	float		sums[2];
+
+	info = &map->bvh_info;
+	info->nodes = 0;
+	info->leaves = 0;
+	info->depth = 0;
+	info->cost = 0.0f;
+	info->built_cost = 0.0f;
+	if (!root)
+		return ;
+	sums[0] = 0.0f;
+	sums[1] = 0.0f;
+	measure_node(info, root, 1, sums);
+	info->cost = bvh_cost(&root->box, sums);
+	info->built_cost = info->cost;
+}
+
+void	bvh_print(t_map *map)
+{
+	static char	*names[3] = {"middle", "median", "sah"};
+	t_bvh_info	*info;
+
+	info = &map->bvh_info;
+	printf("bvh %s: %d objects, %d planes, %d nodes, %d leaves, depth %d, "
+		"built in %.2f ms, expected cost %.2f\n", names[info->split],
+		map->num_bounded, map->pl.count, info->nodes, info->leaves,
+		info->depth, info->build_ms, info->cost);
+	if (info->refits > 0)
+		printf("bvh refits %d, last %.2f ms, %d rebuilds after refit\n",
+			info->refits, info->refit_ms, info->rebuilds);
+	fflush(stdout);
+}
+
+// --bvh middle|median|sah
+t_bvh_split	bvh_split_by_name(char *name)
+{
+	if (!ft_strncmp(name, "middle", 7))
+		return (BVH_MIDDLE);
+	if (!ft_strncmp(name, "median", 7))
+		return (BVH_MEDIAN);
+	if (!ft_strncmp(name, "sah", 4))
+		return (BVH_SAH);
+	error_throw("Unknown bvh split, expected middle, median or sah");
+	return (BVH_SAH);
+}
+
+void	bvh_free(t_bvh_node *node)
+{
+	if (!node)
+		return ;
+	bvh_free(node->left);
+	bvh_free(node->right);
+	free(node);
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_sah.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:37:00 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 11:37:00 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// sorts the primitives into BVH_BINS equal slices of the centroid box
+static void	fill_bins(t_bvh_prim *prims, int count, t_sah *sah, int axis)
+{
+	float	lo;
+	int		bin;
+	int		i;
+
+	i = -1;
+	while (++i < BVH_BINS)
+	{
+		sah->bins[i].box = aabb_empty();
+		sah->bins[i].count = 0;
+	}
+	lo = axis_value(sah->cbox.min, axis);
+	i = -1;
+	while (++i < count)
+	{
+		bin = (int)((axis_value(prims[i].center, axis) - lo) * sah->scale);
+		if (bin >= BVH_BINS)
+			bin = BVH_BINS - 1;
+		if (bin < 0)
+			bin = 0;
+		sah->bins[bin].box = aabb_union(sah->bins[bin].box, prims[i].box);
+		sah->bins[bin].count++;
+	}
+}
+
+// area * count of everything from bin i up to the last bin
+static void	sweep_right(t_sah *sah, float *right)
+{
+	t_aabb	box;
+	int		count;
+	int		i;
+
+	box = aabb_empty();
+	count = 0;
+	i = BVH_BINS;
+	while (--i > 0)
+	{
+		box = aabb_union(box, sah->bins[i].box);
+		count += sah->bins[i].count;
+		right[i] = 0.0f;
+		if (count > 0)
+			right[i] = aabb_area(box) * count;
+	}
+}
+
+// tries the BVH_BINS - 1 planes between the bins of one axis, the cost
+// of a plane is area * count of the left side plus the same on the right
+static void	sweep_axis(t_sah *sah, int axis)
+{
+	float	right[BVH_BINS];
+	t_aabb	box;
+	int		count;
+	int		i;
+	float	cost;
+
+	sweep_right(sah, right);
+	box = aabb_empty();
+	count = 0;
+	i = -1;
+	while (++i < BVH_BINS - 1)
+	{
+		box = aabb_union(box, sah->bins[i].box);
+		count += sah->bins[i].count;
+		cost = aabb_area(box) * count + right[i + 1];
+		if (count > 0 && count < sah->total && cost < sah->cost)
+		{
+			sah->cost = cost;
+			sah->axis = axis;
+			sah->plane = axis_value(sah->cbox.min, axis) + (i + 1) / sah->scale;
+		}
+	}
+}
+
+// cheapest binned split over the three axes, sah->cost stays INFINITY
+// when all the centers fall into a single bin
+static void	find_sah(t_bvh_prim *prims, int count, t_sah *sah)
+{
+	float	extent;
+	int		axis;
+
+	centroid_bounds(prims, count, &sah->cbox);
+	sah->total = count;
+	sah->cost = INFINITY;
+	axis = 0;
+	while (axis < 3)
+	{
+		extent = axis_value(sah->cbox.max, axis)
+			- axis_value(sah->cbox.min, axis);
+		if (extent > 0.0f)
+		{
+			sah->scale = BVH_BINS / extent;
+			fill_bins(prims, count, sah, axis);
+			sweep_axis(sah, axis);
+		}
+		axis++;
+	}
+}
+
+// surface area heuristic split, slower to build than the median but
+// gives the cheapest traversal, returns 0 when a leaf costs less than
+// any split of the primitives
+int	split_sah(t_bvh_prim *prims, int count, t_aabb *box)
+{
+	t_sah	sah;
+	float	area;
+	int		mid;
+
+	find_sah(prims, count, &sah);
+	if (sah.cost == INFINITY)
+		return (split_median(prims, count));
+	area = aabb_area(*box);
+	if (count <= BVH_LEAF_SIZE && SAH_INTERSECT * count * area
+		<= SAH_TRAVERSAL * area + SAH_INTERSECT * sah.cost)
+		return (0);
+	mid = partition_axis(prims, count, sah.axis, sah.plane);
+	if (mid == 0 || mid == count)
+		return (split_median(prims, count));
+	return (mid);
+}
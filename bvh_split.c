@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_split.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:14:22 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 11:49:56 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// union of the boxes of count primitives
+t_aabb	range_bounds(t_bvh_prim *prims, int count)
+{
+	t_aabb	box;
+	int		i;
+
+	box = aabb_empty();
+	i = 0;
+	while (i < count)
+		box = aabb_union(box, prims[i++].box);
+	return (box);
+}
+
+float	aabb_area(t_aabb box)
+{
+	t_float_3	d;
+
+	d = vec_sub(box.max, box.min);
+	return (2.0f * (d.x * d.y + d.y * d.z + d.z * d.x));
+}
+
+// box around the primitive centers, its longest axis is returned
+int	centroid_bounds(t_bvh_prim *prims, int count, t_aabb *cbox)
+{
+	t_float_3	size;
+	int			i;
+
+	*cbox = aabb_empty();
+	i = 0;
+	while (i < count)
+	{
+		*cbox = aabb_union(*cbox, (t_aabb){prims[i].center, prims[i].center});
+		i++;
+	}
+	size = vec_sub(cbox->max, cbox->min);
+	if (size.y > size.x && size.y >= size.z)
+		return (1);
+	if (size.z > size.x && size.z > size.y)
+		return (2);
+	return (0);
+}
+
+// moves the primitives centered below plane on axis to the front,
+// returns how many they are
+int	partition_axis(t_bvh_prim *prims, int count, int axis, float plane)
+{
+	t_bvh_prim	tmp;
+	int			i;
+	int			j;
+
+	i = 0;
+	j = count - 1;
+	while (i <= j)
+	{
+		if (axis_value(prims[i].center, axis) < plane)
+			i++;
+		else
+		{
+			tmp = prims[i];
+			prims[i] = prims[j];
+			prims[j--] = tmp;
+		}
+	}
+	return (i);
+}
+
+// partitions the primitives around the middle of the longest centroid
+// axis, returns how many went left, falls back to the object median
+// when every center lies on the same side
+int	split_middle(t_bvh_prim *prims, int count)
+{
+	t_aabb	cbox;
+	int		axis;
+	int		mid;
+
+	axis = centroid_bounds(prims, count, &cbox);
+	mid = partition_axis(prims, count, axis, (axis_value(cbox.min, axis)
+				+ axis_value(cbox.max, axis)) / 2.0f);
+	if (mid == 0 || mid == count)
+		return (split_median(prims, count));
+	return (mid);
+}
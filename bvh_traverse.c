@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_traverse.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:19:13 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:00:21 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the count objects of ids, a leaf or a tile bin, against the camera ray
+// of closest, runs of one type go to the batched kernels, lone ones to
+// the camera ray tests
+void	leaf_closest(t_ctx *ctx, t_trace *closest, int *ids, int count)
+{
+	float	t;
+	int		n;
+	int		i;
+
+	i = 0;
+	while (i < count)
+	{
+		n = obj_run(ids + i, count - i);
+		if (n)
+			run_nearest(ctx->map, ids + i, n, closest);
+		else if (intersect_primary(ctx->map, closest->ray, ids[i], &t)
+			&& t < closest->t)
+			record_hit(closest, ids[i], t);
+		n += (n == 0);
+		ctx->stats->tests += n;
+		i += n;
+	}
+}
+
+// nearest sphere or cylinder hit of a camera ray, nodes farther than the
+// closest hit found so far are skipped
+void	bvh_closest(t_ctx *ctx, t_ray ray, t_trace *closest)
+{
+	t_bvh_stack	st;
+	t_bvh_flat	*node;
+
+	bvh_stack_init(&st, &ray, ctx->map);
+	while (st.top > 0)
+	{
+		st.top--;
+		if (st.t[st.top] >= closest->t)
+			continue ;
+		node = &st.nodes[st.node[st.top]];
+		ctx->stats->nodes++;
+		if (node->count)
+			leaf_closest(ctx, closest, ctx->map->bounded + node->index,
+				node->count);
+		else
+			bvh_push_children(&st, st.node[st.top]);
+	}
+}
+
+static int	leaf_occluded(t_ctx *ctx, t_bvh_flat *node, t_trace *sh)
+{
+	int		*prims;
+	float	t;
+	int		n;
+	int		i;
+
+	prims = ctx->map->bounded + node->index;
+	i = 0;
+	while (i < node->count && sh->hit_id < 0)
+	{
+		n = obj_run(prims + i, node->count - i);
+		if (n)
+			run_nearest(ctx->map, prims + i, n, sh);
+		else if (intersect(ctx->map, sh->ray, prims[i], &t) && t < sh->t)
+			record_hit(sh, prims[i], t);
+		n += (n == 0);
+		ctx->stats->shadow_tests += n;
+		i += n;
+	}
+	if (sh->hit_id < 0)
+		return (0);
+	ctx->occluder = sh->hit_id;
+	return (1);
+}
+
+// any sphere or cylinder hit before max_dist, front to back, stops in
+// the first leaf with one and keeps it as the occluder to try first
+// next time
+int	bvh_occluded(t_ctx *ctx, t_ray *ray, float max_dist)
+{
+	t_bvh_stack	st;
+	t_bvh_flat	*node;
+	t_trace		sh;
+
+	sh.ray = *ray;
+	sh.t = max_dist;
+	sh.hit_id = -1;
+	bvh_stack_init(&st, ray, ctx->map);
+	while (st.top > 0)
+	{
+		st.top--;
+		if (st.t[st.top] >= max_dist)
+			continue ;
+		node = &st.nodes[st.node[st.top]];
+		ctx->stats->shadow_nodes++;
+		if (node->count && leaf_occluded(ctx, node, &sh))
+			return (1);
+		if (!node->count)
+			bvh_push_children(&st, st.node[st.top]);
+	}
+	return (0);
+}
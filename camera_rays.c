@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   camera_rays.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:31:05 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 15:31:05 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the camera ray through pixel x, y was
+// up * height * (2y / H - 1) + right * width * (2x / W - 1) + cam.vec,
+// the same sum taken apart into the corner and steps of one pixel, redone
+// whenever the camera turns
+void	camera_prepare(t_map *map)
+{
+	map->ray_du = vec_mul(map->vec_right, 2.0f * map->width / WINDOW_WIDTH);
+	map->ray_dv = vec_mul(map->vec_up, 2.0f * map->height / WINDOW_HEIGHT);
+	map->ray_corner = vec_sub(vec_sub(map->cam.vec,
+				vec_mul(map->vec_up, map->height)),
+			vec_mul(map->vec_right, map->width));
+}
+
+#ifdef __SSE__
+
+// inv_sqrt() lane wise
+static t_v4	v4_inv_sqrt(t_v4 x)
+{
+	t_v4	y;
+
+	y = (t_v4)_mm_rsqrt_ps((__m128)x);
+	return (y * (1.5f - 0.5f * x * y * y));
+}
+#else
+
+static t_v4	v4_inv_sqrt(t_v4 x)
+{
+	return (1.0f / v4_sqrt(x));
+}
+#endif
+
+// unit directions into d of the 4 rays at pixel columns x of the row
+// starting at base
+static void	row4(t_map *map, t_v4 *d, t_float_3 base, t_v4 x)
+{
+	t_v4	inv;
+
+	d[0] = base.x + x * map->ray_du.x;
+	d[1] = base.y + x * map->ray_du.y;
+	d[2] = base.z + x * map->ray_du.z;
+	inv = v4_inv_sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+	d[0] *= inv;
+	d[1] *= inv;
+	d[2] *= inv;
+}
+
+// the n camera rays of row at.y from column at.x on, at.z columns apart,
+// 4 per step
+void	camera_row(t_map *map, t_int_3 at, int n, t_ray *rays)
+{
+	t_float_3	base;
+	t_v4		d[3];
+	int			i;
+	int			k;
+
+	base = vec_add(map->ray_corner, vec_mul(map->ray_dv, at.y));
+	i = 0;
+	while (i < n)
+	{
+		row4(map, d, base, (float)at.x + (float)at.z
+			* ((t_v4){0, 1, 2, 3} + (float)i));
+		k = -1;
+		while (++k < 4 && i + k < n)
+		{
+			rays[i + k].orig = map->cam.pos;
+			rays[i + k].dir = (t_float_3){d[0][k], d[1][k], d[2][k]};
+		}
+		i += 4;
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/02/20 19:24:39 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/14 15:05:23 by fvonsovs         ###   ########.fr       */
+/*   Updated: 2026/10/18 18:20:33 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,7 +14,9 @@
 
 int	handle_destroy_notify(t_win *win)
 {
-	mlx_destroy_image(win->mlx, win->img);
+	render_shutdown(win);
+	mlx_destroy_image(win->mlx, win->img[0]);
+	mlx_destroy_image(win->mlx, win->img[1]);
 	mlx_destroy_window(win->mlx, win->win);
 	exit(0);
 }
@@ -31,6 +33,7 @@ int	print_controls(t_win *win)
 // IKJLUIO to move light
 // TGHFYR to move camera
 // 456789 to rotate camera
+// P to print the per thread render statistics
 // ESC to exit
 // +/- to resize objects
 
@@ -52,6 +55,8 @@ void	handle_keypress_without_angle(int keysym, t_win *win)
 		move_camera(win, keysym);
 	else if (keysym == KEY_NUMPAD_PLUS || keysym == KEY_NUMPAD_MINUS)
 		resize_objects(win, keysym);
+	else if (keysym == KEY_P)
+		key_stats(win);
 }
 
 void	handle_keypress_with_angle(int keysym, t_win *win)
@@ -73,19 +78,20 @@ void	handle_keypress_with_angle(int keysym, t_win *win)
 		rotate_camera(win, keysym, angle);
 }
 
+// the frame in flight is cancelled before any edit, the workers only
+// finish the tile they are on so the scene is never read while modified.
+// keys that change nothing let it finish
 int	handle_keypress(int keysym, t_win *win)
 {
-	if (keysym == KEY_UP || keysym == KEY_DOWN || keysym == KEY_LEFT
-		|| keysym == KEY_RIGHT || keysym == KEY_DOT || keysym == KEY_COMMA
-		|| keysym == KEY_Z || keysym == KEY_X || keysym == KEY_C
-		|| keysym == KEY_V || keysym == KEY_B || keysym == KEY_N
-		|| keysym == KEY_4 || keysym == KEY_5 || keysym == KEY_6
-		|| keysym == KEY_7 || keysym == KEY_8 || keysym == KEY_9)
+	if (key_rotates(keysym))
 	{
+		render_cancel(win);
 		handle_keypress_with_angle(keysym, win);
 	}
 	else
 	{
+		if (key_moves(keysym))
+			render_cancel(win);
 		handle_keypress_without_angle(keysym, win);
 	}
 	return (0);
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   controls_keys.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:38:52 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:20:33 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// whether a key of handle_keypress_without_angle() edits the scene or
+// moves the camera, ESC, P and unmapped keys leave the frame alone
+int	key_moves(int keysym)
+{
+	return (keysym == KEY_W || keysym == KEY_S || keysym == KEY_A
+		|| keysym == KEY_D || keysym == KEY_Q || keysym == KEY_E
+		|| keysym == KEY_I || keysym == KEY_K || keysym == KEY_J
+		|| keysym == KEY_L || keysym == KEY_U || keysym == KEY_O
+		|| keysym == KEY_T || keysym == KEY_G || keysym == KEY_F
+		|| keysym == KEY_H || keysym == KEY_R || keysym == KEY_Y
+		|| keysym == KEY_NUMPAD_PLUS || keysym == KEY_NUMPAD_MINUS);
+}
+
+// whether a key of handle_keypress_with_angle() rotates an object or the
+// camera
+int	key_rotates(int keysym)
+{
+	return (keysym == KEY_UP || keysym == KEY_DOWN || keysym == KEY_LEFT
+		|| keysym == KEY_RIGHT || keysym == KEY_DOT || keysym == KEY_COMMA
+		|| keysym == KEY_Z || keysym == KEY_X || keysym == KEY_C
+		|| keysym == KEY_V || keysym == KEY_B || keysym == KEY_N
+		|| keysym == KEY_4 || keysym == KEY_5 || keysym == KEY_6
+		|| keysym == KEY_7 || keysym == KEY_8 || keysym == KEY_9);
+}
+
+// P, the workers write their counters while a pass is traced, so the
+// report waits for render_collect() to see the pass over
+void	key_stats(t_win *win)
+{
+	if (win->in_flight)
+		win->stats_wanted = 1;
+	else
+		print_render_stats(win);
+}
@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cpu.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:25:52 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:11:47 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// one render thread per cpu the process may actually run on:
+// online cores, narrowed by the affinity mask and the cgroup quota
+int	default_threads(int num_cores)
+{
+	int	count;
+	int	quota;
+
+	count = affinity_count();
+	if (count <= 0)
+		count = num_cores;
+	quota = cgroup_cpus();
+	if (quota > 0 && quota < count)
+		count = quota;
+	if (count < 1)
+		count = 1;
+	if (count > MAX_THREADS)
+		count = MAX_THREADS;
+	return (count);
+}
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cpu_affinity.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:27:29 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:59:11 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "minirt.h"
+#ifdef __linux__
+# include <sched.h>
+
+// number of cpus in the affinity mask of the process (taskset, cpusets)
+int	affinity_count(void)
+{
+	cpu_set_t	set;
+
+	CPU_ZERO(&set);
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &set) != 0)
+		return (0);
+	return (CPU_COUNT(&set));
+}
+
+// pins worker i to the i-th cpu of the process affinity mask, wrapping
+// around when there are more workers than allowed cpus
+void	pool_pin(t_pool *pool)
+{
+	cpu_set_t	allowed;
+	cpu_set_t	one;
+	int			cpu;
+	int			i;
+
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0
+		|| CPU_COUNT(&allowed) == 0)
+		return ;
+	cpu = 0;
+	i = 0;
+	while (i < pool->count)
+	{
+		while (!CPU_ISSET(cpu % CPU_SETSIZE, &allowed))
+			cpu++;
+		CPU_ZERO(&one);
+		CPU_SET(cpu % CPU_SETSIZE, &one);
+		pthread_setaffinity_np(pool->threads[i], sizeof(cpu_set_t), &one);
+		cpu++;
+		i++;
+	}
+}
+
+#else
+
+int	affinity_count(void)
+{
+	return (0);
+}
+
+// macOS has no way to bind a thread to a given core
+void	pool_pin(t_pool *pool)
+{
+	(void)pool;
+}
+
+#endif
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cpu_cgroup.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:04:10 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:11:47 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// reads at most size - 1 bytes of the small text file dir/name, 0 if
+// unreadable
+static int	read_small_file(char *dir, char *name, char *buf, int size)
+{
+	char	path[PATH_MAX];
+	int		fd;
+	int		len;
+
+	ft_strlcpy(path, dir, PATH_MAX);
+	ft_strlcat(path, name, PATH_MAX);
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (0);
+	len = read(fd, buf, size - 1);
+	close(fd);
+	if (len < 0)
+		len = 0;
+	buf[len] = '\0';
+	return (len);
+}
+
+// the path of a "id:controllers:path" line of /proc/self/cgroup when ctl
+// is one of its controllers, "" matches the empty list of cgroup v2
+static char	*cgroup_line(char *line, char *ctl)
+{
+	int	n;
+
+	n = ft_strlen(ctl);
+	line = ft_strchr(line, ':');
+	while (line && *line)
+	{
+		line++;
+		if (!ft_strncmp(line, ctl, n) && (line[n] == ':' || line[n] == ','))
+			return (ft_strchr(line, ':') + 1);
+		while (*line && *line != ',' && *line != ':')
+			line++;
+		if (*line != ',')
+			return (NULL);
+	}
+	return (NULL);
+}
+
+// base followed by the cgroup of this process for ctl into dir, a root
+// cgroup adds nothing. the length of base, 0 when the process is not in
+// a cgroup for ctl
+static int	cgroup_dir(char *ctl, char *base, char *dir, int size)
+{
+	char	buf[4096];
+	char	*line;
+	char	*end;
+	char	*path;
+
+	if (!read_small_file("/proc/self", "/cgroup", buf, 4096))
+		return (0);
+	line = buf;
+	while (line && *line)
+	{
+		end = ft_strchr(line, '\n');
+		if (end)
+			*end++ = '\0';
+		path = cgroup_line(line, ctl);
+		if (path)
+		{
+			ft_strlcpy(dir, base, size);
+			if (ft_strncmp(path, "/", 2))
+				ft_strlcat(dir, path, size);
+			return (ft_strlen(base));
+		}
+		line = end;
+	}
+	return (0);
+}
+
+// cpus granted by the quota of the cgroup at dir, rounded up, 0 when
+// unlimited. v2 has "<quota|max> <period>" in cpu.max, v1 splits the
+// same two numbers across cfs_quota_us and cfs_period_us
+static int	dir_cpus(char *dir, int v2)
+{
+	char	buf[64];
+	long	quota;
+	long	period;
+
+	quota = 0;
+	period = 0;
+	if (v2 && read_small_file(dir, "/cpu.max", buf, 64) && buf[0] != 'm')
+	{
+		quota = ft_atoi(buf);
+		if (ft_strchr(buf, ' '))
+			period = ft_atoi(ft_strchr(buf, ' ') + 1);
+	}
+	else if (!v2 && read_small_file(dir, "/cpu.cfs_quota_us", buf, 64))
+	{
+		quota = ft_atoi(buf);
+		if (read_small_file(dir, "/cpu.cfs_period_us", buf, 64))
+			period = ft_atoi(buf);
+	}
+	if (quota <= 0 || period <= 0)
+		return (0);
+	return ((quota + period - 1) / period);
+}
+
+// the tightest quota on the cgroup of this process, from the path in
+// /proc/self/cgroup, and on its parents. the v1 cpu controller wins over
+// v2 on hybrid systems, 0 when nothing limits the process
+int	cgroup_cpus(void)
+{
+	char	dir[PATH_MAX];
+	int		base;
+	int		v2;
+	int		best;
+	int		cpus;
+
+	v2 = 0;
+	base = cgroup_dir("cpu", "/sys/fs/cgroup/cpu", dir, PATH_MAX);
+	if (!base)
+	{
+		v2 = 1;
+		base = cgroup_dir("", "/sys/fs/cgroup", dir, PATH_MAX);
+	}
+	if (!base)
+		return (0);
+	best = 0;
+	while (1)
+	{
+		cpus = dir_cpus(dir, v2);
+		if (cpus > 0 && (!best || cpus < best))
+			best = cpus;
+		if ((int)ft_strlen(dir) <= base)
+			return (best);
+		*ft_strrchr(dir, '/') = '\0';
+	}
+}
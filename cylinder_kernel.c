@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cylinder_kernel.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:52:30 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 14:52:30 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// quad_roots() and hit_cyl_side() per lane, INFINITY where the side is
+// missed
+static t_v4	cyl_side4(t_cyl_lanes *l)
+{
+	t_v4	oc[3];
+	t_v4	dxa[3];
+	t_v4	oxa[3];
+	t_v4	q[2];
+	t_m4	m;
+
+	oc[0] = l->o[0] - l->p[0];
+	oc[1] = l->o[1] - l->p[1];
+	oc[2] = l->o[2] - l->p[2];
+	v4_cross(dxa, l->d, l->a);
+	v4_cross(oxa, oc, l->a);
+	q[0] = v4_dot(dxa, dxa);
+	q[1] = v4_dot(oxa, dxa);
+	oc[0] = v4_sqrt(q[0] * (l->rad2 - v4_reject2(oxa, dxa, q[1] / q[0])));
+	oc[1] = (-q[1] - oc[0]) / q[0];
+	oc[2] = (-q[1] + oc[0]) / q[0];
+	oc[1] = v4_select(oc[1] > oc[2], oc[2], oc[1]);
+	dxa[0] = (l->o[0] + l->d[0] * oc[1]) - l->p[0];
+	dxa[1] = (l->o[1] + l->d[1] * oc[1]) - l->p[1];
+	dxa[2] = (l->o[2] + l->d[2] * oc[1]) - l->p[2];
+	q[0] = v4_dot(dxa, l->a);
+	m = (oc[1] >= 1e-6f) & (q[0] >= 0.0f) & (q[0] <= l->hth);
+	return (v4_select(m, oc[1], (t_v4){} + INFINITY));
+}
+
+// intersect_disk() per lane for the caps centered on c, INFINITY where
+// they are missed, the distance to the rim is compared squared
+static t_v4	cyl_disk4(t_cyl_lanes *l, t_v4 *c, t_v4 denom)
+{
+	t_v4	v[3];
+	t_v4	t;
+	t_m4	m;
+
+	v[0] = c[0] - l->o[0];
+	v[1] = c[1] - l->o[1];
+	v[2] = c[2] - l->o[2];
+	t = v4_dot(v, l->a) / denom;
+	v[0] = (l->o[0] + l->d[0] * t) - c[0];
+	v[1] = (l->o[1] + l->d[1] * t) - c[1];
+	v[2] = (l->o[2] + l->d[2] * t) - c[2];
+	m = ((t_v4)((t_m4)denom & 0x7fffffff) > 1e-4f) & (t >= 1e-6f);
+	m &= v4_dot(v, v) <= l->rad2;
+	return (v4_select(m, t, (t_v4){} + INFINITY));
+}
+
+// cylinder_intersect() for the 4 lanes without a branch, the distance
+// of the hit per lane or INFINITY
+t_v4	cyl_t4(t_cyl_lanes *l)
+{
+	t_v4	side;
+	t_v4	cap;
+	t_v4	limit;
+	t_v4	denom;
+	t_m4	m;
+
+	side = cyl_side4(l);
+	limit = side - 1e-6f;
+	denom = v4_dot(l->d, l->a);
+	cap = cyl_disk4(l, l->c, denom);
+	m = cap < limit;
+	side = v4_select(m, cap, side);
+	limit = v4_select(m, cap, limit);
+	cap = cyl_disk4(l, l->p, denom);
+	return (v4_select(cap < limit, cap, side));
+}
+
+// the cylinders i to i + 3 into the lanes, the ray is left alone
+static void	cyl_lanes_load(t_cyl_lanes *l, t_cylinders *cy, int i)
+{
+	l->p[0] = *(t_v4u *)(cy->x + i);
+	l->p[1] = *(t_v4u *)(cy->y + i);
+	l->p[2] = *(t_v4u *)(cy->z + i);
+	l->a[0] = *(t_v4u *)(cy->ax + i);
+	l->a[1] = *(t_v4u *)(cy->ay + i);
+	l->a[2] = *(t_v4u *)(cy->az + i);
+	l->c[0] = *(t_v4u *)(cy->tx + i);
+	l->c[1] = *(t_v4u *)(cy->ty + i);
+	l->c[2] = *(t_v4u *)(cy->tz + i);
+	l->rad2 = *(t_v4u *)(cy->rad2 + i);
+	l->hth = *(t_v4u *)(cy->hth + i);
+}
+
+// nearest of the count cylinders from index first closer than
+// closest->t, 4 per step, 1 when there was one
+int	cylinders_nearest(t_cylinders *cy, int first, int count, \
+t_trace *closest)
+{
+	t_cyl_lanes	l;
+	t_v4		t;
+	int			hit;
+	int			i;
+
+	l.o[0] = (t_v4){} + closest->ray.orig.x;
+	l.o[1] = (t_v4){} + closest->ray.orig.y;
+	l.o[2] = (t_v4){} + closest->ray.orig.z;
+	l.d[0] = (t_v4){} + closest->ray.dir.x;
+	l.d[1] = (t_v4){} + closest->ray.dir.y;
+	l.d[2] = (t_v4){} + closest->ray.dir.z;
+	hit = closest->hit_id;
+	i = 0;
+	while (i < count)
+	{
+		cyl_lanes_load(&l, cy, first + i);
+		t = v4_select((t_m4){0, 1, 2, 3} < count - i, cyl_t4(&l),
+				(t_v4){} + INFINITY);
+		lanes_pick((float *)&t, ((first + i) << OBJ_TYPE_BITS) | CYLINDER,
+			4, closest);
+		i += 4;
+	}
+	return (closest->hit_id != hit);
+}
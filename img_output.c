@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   img_output.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:58:40 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:31:08 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// v as 4 big endian bytes at p
+void	put_be32(unsigned char *p, unsigned int v)
+{
+	p[0] = v >> 24;
+	p[1] = v >> 16;
+	p[2] = v >> 8;
+	p[3] = v;
+}
+
+// --output FILE, the format comes from the extension, .ppm or .png
+char	*output_path(char *path)
+{
+	size_t	len;
+
+	if (!path)
+		error_throw("Missing output file");
+	len = ft_strlen(path);
+	if (len < 5 || (ft_strncmp(path + len - 4, ".ppm", 5)
+			&& ft_strncmp(path + len - 4, ".png", 5)))
+		error_throw("Unknown output format, expected .ppm or .png");
+	return (path);
+}
+
+// the finished frame as 8 bit r, g, b triplets into dst, rows stride
+// bytes apart, the frame buffer of headless_init() holds native 0xRRGGBB
+// ints
+void	frame_rgb(t_win *win, unsigned char *dst, size_t stride)
+{
+	unsigned int	*row;
+	int				x;
+	int				y;
+
+	y = -1;
+	while (++y < WINDOW_HEIGHT)
+	{
+		row = (unsigned int *)(win->addr[win->back] + y * win->line_l);
+		x = -1;
+		while (++x < WINDOW_WIDTH)
+		{
+			dst[y * stride + 3 * x] = row[x] >> 16;
+			dst[y * stride + 3 * x + 1] = row[x] >> 8;
+			dst[y * stride + 3 * x + 2] = row[x];
+		}
+	}
+}
+
+static void	ppm_write(t_win *win, int fd)
+{
+	unsigned char	*rgb;
+	size_t			size;
+
+	size = (size_t)WINDOW_WIDTH * WINDOW_HEIGHT * 3;
+	rgb = malloc(size);
+	if (!rgb)
+		error_throw("Cannot allocate the output image");
+	frame_rgb(win, rgb, (size_t)WINDOW_WIDTH * 3);
+	if (dprintf(fd, "P6\n%d %d\n255\n", WINDOW_WIDTH, WINDOW_HEIGHT) < 0
+		|| write(fd, rgb, size) != (ssize_t)size)
+		error_throw("Cannot write the output file");
+	free(rgb);
+}
+
+// saves the finished frame to path, see output_path()
+void	image_write(t_win *win, char *path)
+{
+	int	fd;
+
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		error_throw("Cannot open the output file");
+	if (!ft_strncmp(path + ft_strlen(path) - 4, ".png", 5))
+		png_write(win, fd);
+	else
+		ppm_write(win, fd);
+	if (close(fd) < 0)
+		error_throw("Cannot write the output file");
+	printf("saved %s\n", path);
+}
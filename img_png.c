@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   img_png.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:06:12 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:31:08 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+static unsigned int	png_crc(unsigned char *p, size_t n)
+{
+	unsigned int	c;
+	int				k;
+
+	c = 0xFFFFFFFF;
+	while (n--)
+	{
+		c ^= *p++;
+		k = -1;
+		while (++k < 8)
+			c = (c >> 1) ^ (0xEDB88320 & -(c & 1));
+	}
+	return (~c);
+}
+
+static unsigned int	png_adler(unsigned char *p, size_t n)
+{
+	unsigned int	a;
+	unsigned int	b;
+
+	a = 1;
+	b = 0;
+	while (n--)
+	{
+		a = (a + *p++) % 65521;
+		b = (b + a) % 65521;
+	}
+	return ((b << 16) | a);
+}
+
+// the len bytes of data already at p + 8 made into a chunk, returns its
+// whole size
+static size_t	png_chunk(unsigned char *p, char *type, size_t len)
+{
+	put_be32(p, len);
+	ft_memcpy(p + 4, type, 4);
+	put_be32(p + 8 + len, png_crc(p + 4, len + 4));
+	return (len + 12);
+}
+
+// the n bytes of raw as a zlib stream of stored deflate blocks, nothing
+// is compressed, returns the size of the stream
+static size_t	png_zlib(unsigned char *dst, unsigned char *raw, size_t n)
+{
+	size_t	out;
+	size_t	len;
+	size_t	i;
+
+	dst[0] = 0x78;
+	dst[1] = 0x01;
+	out = 2;
+	i = 0;
+	while (i < n)
+	{
+		len = n - i;
+		if (len > 65535)
+			len = 65535;
+		dst[out] = (i + len == n);
+		dst[out + 1] = len & 0xFF;
+		dst[out + 2] = len >> 8;
+		dst[out + 3] = ~len & 0xFF;
+		dst[out + 4] = (~len >> 8) & 0xFF;
+		ft_memcpy(dst + out + 5, raw + i, len);
+		out += len + 5;
+		i += len;
+	}
+	put_be32(dst + out, png_adler(raw, n));
+	return (out + 4);
+}
+
+// the frame as an 8 bit rgb png, every row starts with filter type none.
+// the file is the signature, IHDR, the n bytes of rows in stored blocks of
+// at most 65535 with a 5 byte header each inside a 6 byte zlib frame in
+// IDAT, and IEND, 12 bytes of length, type and crc per chunk
+void	png_write(t_win *win, int fd)
+{
+	unsigned char	*raw;
+	unsigned char	*png;
+	size_t			n;
+	size_t			len;
+
+	n = (1 + (size_t)WINDOW_WIDTH * 3) * WINDOW_HEIGHT;
+	raw = ft_calloc(n, 1);
+	png = malloc(8 + (12 + 13) + (12 + 6 + n + 5 * ((n + 65534) / 65535))
+			+ 12);
+	if (!raw || !png)
+		error_throw("Cannot allocate the output image");
+	frame_rgb(win, raw + 1, 1 + (size_t)WINDOW_WIDTH * 3);
+	ft_memcpy(png, "\x89PNG\r\n\x1a\n", 8);
+	put_be32(png + 16, WINDOW_WIDTH);
+	put_be32(png + 20, WINDOW_HEIGHT);
+	ft_memcpy(png + 24, "\x08\x02\0\0\0", 5);
+	len = 8 + png_chunk(png + 8, "IHDR", 13);
+	len += png_chunk(png + len, "IDAT", png_zlib(png + len + 8, raw, n));
+	len += png_chunk(png + len, "IEND", 0);
+	if (write(fd, png, len) != (ssize_t)len)
+		error_throw("Cannot write the output file");
+	free(raw);
+	free(png);
+}
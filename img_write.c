@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   img_write.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:14:26 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 15:14:26 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// 32 bit pixels in the byte order of the machine, the colors already
+// are the pixels
+static void	row_native(t_win *win, char *dst, int *src, int n)
+{
+	(void)win;
+	ft_memcpy(dst, src, n * sizeof(int));
+}
+
+// 32 bit pixels in the other byte order
+static void	row_swapped(t_win *win, char *dst, int *src, int n)
+{
+	unsigned int	*pixel;
+	int				i;
+
+	(void)win;
+	pixel = (unsigned int *)dst;
+	i = -1;
+	while (++i < n)
+		pixel[i] = __builtin_bswap32(src[i]);
+}
+
+// any other depth, byte by byte
+// big endian, MSB is the leftmost bit
+// little endian, LSB is the leftmost bit
+static void	row_bytes(t_win *win, char *dst, int *src, int n)
+{
+	int	i;
+
+	while (n-- > 0)
+	{
+		i = win->bpp - 8;
+		while (i >= 0)
+		{
+			if (win->endian != 0)
+				*dst++ = (*src >> i) & 0xFF;
+			else
+				*dst++ = (*src >> (win->bpp - 8 - i)) & 0xFF;
+			i -= 8;
+		}
+		src++;
+	}
+}
+
+// the writer for the format mlx gave the images
+t_row_writer	row_writer(t_win *win)
+{
+	if (win->bpp != 32)
+		return (row_bytes);
+	if ((win->endian != 0) == (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
+		return (row_native);
+	return (row_swapped);
+}
+
+// copies the finished tile of ctx into the back image row by row
+void	tile_flush(t_ctx *ctx, t_rect *rect)
+{
+	t_win	*win;
+	int		y;
+
+	win = ctx->win;
+	y = rect->y0;
+	while (y < rect->y1)
+	{
+		win->put_row(win, win->addr[win->back] + y * win->line_l
+			+ rect->x0 * (win->bpp / 8),
+			ctx->tile + (y - rect->y0) * win->sched.tile_size,
+			rect->x1 - rect->x0);
+		y++;
+	}
+}
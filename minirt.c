@@ -6,33 +6,62 @@
 /*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/02/11 18:04:04 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/14 14:48:04 by fvonsovs         ###   ########.fr       */
+/*   Updated: 2026/10/18 18:36:44 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
+static void	usage(char *name)
+{
+	ft_printf("Usage: %s <[FILE].rt> [options]\n"
+		"  --threads N         render threads, default one per cpu\n"
+		"  --tile N            tile size in pixels\n"
+		"  --bvh SPLIT         middle, median or sah (default)\n"
+		"  --accel bvh|bins    camera rays through the bvh (default) or\n"
+		"                      the objects binned to their tile\n"
+		"  --output FILE       render once without a window and save\n"
+		"                      the image as .ppm or .png\n"
+		"  --pin               pin each thread to one cpu\n"
+		"  --no-progressive    skip the coarse preview passes\n"
+		"  --no-packets        trace camera rays one by one\n", name);
+	exit(1);
+}
+
+// the window, or the frame buffer of --output, then the workers and the
+// bvh of the parsed scene
+static void	start(t_win *win)
+{
+	if (win->opts.output)
+		headless_init(win);
+	else
+		window_init(win);
+	win->num_cores = sysconf(_SC_NPROCESSORS_ONLN);
+	render_setup(win);
+	bvh_build(win->map, &win->pool);
+	scene_compile(win->map);
+	bvh_print(win->map);
+}
+
 int	main(int argc, char **argv)
 {
 	t_win	win;
 	t_map	*map;
 
-	if (argc != 2)
-		exit(ft_printf("Usage: %s <[FILE].rt>\n", argv[0]));
-	map = parser(argv[1]);
+	ft_bzero(&win, sizeof(t_win));
+	if (parse_options(&win.opts, argc, argv))
+		usage(argv[0]);
+	map = parser(win.opts.scene);
 	camera_init(map);
+	map->bvh_info.split = win.opts.bvh;
 	win.map = map;
-	win.mlx = mlx_init();
-	win.win = mlx_new_window(win.mlx, WINDOW_WIDTH, WINDOW_HEIGHT, "miniRT");
-	win.img = mlx_new_image(win.mlx, WINDOW_WIDTH, WINDOW_HEIGHT);
-	win.addr = mlx_get_data_addr(win.img, &win.bpp, &win.line_l, &win.endian);
-	win.num_cores = sysconf(_SC_NPROCESSORS_ONLN);
-	mlx_loop_hook(win.mlx, render, &win);
-	mlx_hook(win.win, 2, 1L << 0, handle_keypress, &win);
-	mlx_hook(win.win, 17, 0, handle_destroy_notify, &win);
-	mlx_loop(win.mlx);
-	free(win.map);
-	free(map);
+	start(&win);
+	if (win.opts.output)
+		render_offline(&win);
+	else
+		run_window(&win);
+	render_shutdown(&win);
+	free_map(map);
 	free(win.mlx);
 	return (0);
 }
@@ -6,7 +6,7 @@
 /*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/02/11 18:07:24 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/14 15:18:11 by fvonsovs         ###   ########.fr       */
+/*   Updated: 2026/10/18 18:36:44 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,12 +19,17 @@
 # include <math.h>
 # include <pthread.h>
 # include <unistd.h>
+# include <time.h>
+# include <limits.h>
+# ifdef __SSE__
+#  include <xmmintrin.h>
+# endif
 
-# ifdef __linux__
+# if defined(__linux__) && !defined(HEADLESS)
 #  include "./minilibx-linux/mlx.h"
 #  include <X11/X.h>
 #  include <X11/keysym.h>
-# elif __APPLE__
+# elif defined(__APPLE__) && !defined(HEADLESS)
 #  include "./minilibx-mac-osx/mlx.h"
 #  include <ApplicationServices/ApplicationServices.h>
 # endif
@@ -144,12 +149,30 @@ enum e_keycodes
 
 // math macros
 # define PI 3.1415926535f
+// offset of a shadow ray off the surface per unit of scene size, about 80
+// float steps, the float rounding of a hit point grows with its distance
+# define SHADOW_BIAS 1e-5f
 
 // god's chosen aspect ratio
 # define WINDOW_WIDTH 1280
 # define WINDOW_HEIGHT 1024
-// change this later
-# define NUM_THREADS 8
+// upper bound for --threads, the default is one per available cpu
+# define MAX_THREADS 1024
+// side of the square tiles handed out to the render threads
+# define TILE_SIZE 32
+// how long the loop hook sleeps when the scene did not change
+# define IDLE_SLEEP_US 10000
+// progressive preview, first pass traces one pixel per PREVIEW_STEP
+// square block, the block is made coarser (up to MAX_PREVIEW_STEP)
+// while that pass takes longer than PREVIEW_BUDGET_MS
+# define PREVIEW_STEP 8
+# define MAX_PREVIEW_STEP 64
+# define PREVIEW_BUDGET_MS 40
+// entries of the linear to srgb table, enough for every 8 bit color to
+// come back unchanged
+# define SRGB_LUT_SIZE 4096
+// how often the event loop checks on a frame traced in the background
+# define POLL_SLEEP_US 1000
 
 typedef enum e_obj_type
 {
@@ -206,14 +229,21 @@ typedef struct s_light
 	int				col;
 }	t_light;
 
-// objects in scene (linked list)
+// axis aligned bounding box
+typedef struct s_aabb
+{
+	t_float_3		min;
+	t_float_3		max;
+}	t_aabb;
+
+// one object as read by the parser, the scene keeps them in the
+// structure of arrays below
 // spheres - pos = sp center coords, dia = diameter, col = color in hex format
 typedef struct s_sp
 {
 	t_float_3		pos;
 	float			dia;
 	int				col;
-	struct s_sp		*next;
 }	t_sp;
 
 // planes - pos = xyz coords of a point in plane
@@ -223,7 +253,6 @@ typedef struct s_pl
 	t_float_3		pos;
 	t_float_3		vec;
 	int				col;
-	struct s_pl		*next;
 }	t_pl;
 
 // cylinders - pos = xyz coords of center
@@ -236,18 +265,106 @@ typedef struct s_cy
 	float			dia;
 	float			hth;
 	int				col;
-	struct s_cy		*next;
 }	t_cy;
 
-// main object holding struct
-typedef struct s_obj
+// objects of the scene, one array per field and per type, filled in
+// file order. an object is named by its id, index << OBJ_TYPE_BITS | type,
+// which stays the same for as long as the scene lives
+# define OBJ_TYPE_BITS 2
+# define OBJ_TYPE_MASK 3
+// mask of every object type
+# define OBJ_ALL_TYPES 7
+// room for this many objects of a type is made on the first one,
+// doubled whenever it runs out
+# define SCENE_MIN_CAP 16
+// every array has room for SCENE_PAD more elements than cap, so the
+// batched kernels can load whole vectors past the last object
+# define SCENE_PAD 8
+// runs of fewer consecutive spheres are cheaper one by one, cylinders
+// are cheaper batched even alone
+# define SPHERE_BATCH_MIN 3
+
+// nearest of the count spheres from index first closer than closest->t,
+// recorded in closest, 1 when there was one. picked once at startup,
+// see sphere_kernel()
+struct	s_spheres;
+struct	s_trace;
+
+typedef int		(*t_sphere_kernel)(struct s_spheres *sp, int first, \
+int count, struct s_trace *closest);
+
+// the fields below col are derived from the ones above by scene_prepare()
+// after every edit, so the intersection code does not redo it per ray.
+// the fields starting with o only hold for rays from the camera, they
+// are redone by scene_view() before every pass the scene or camera moved
+
+// x, y, z = centers, rad = radii
+// rad2 = squared radii, box = bounds
+// ox, oy, oz = camera minus centers
+typedef struct s_spheres
 {
-	t_obj_type		type;
-	void			*object;
-	int				color;
-	int				id;
-	struct s_obj	*next;
-}	t_obj;
+	float			*x;
+	float			*y;
+	float			*z;
+	float			*rad;
+	int				*col;
+	float			*rad2;
+	t_aabb			*box;
+	float			*ox;
+	float			*oy;
+	float			*oz;
+	int				count;
+	int				cap;
+	t_sphere_kernel	nearest;
+}	t_spheres;
+
+// x, y, z = points in the planes, nx, ny, nz = normals as given
+// ux, uy, uz = unit normals, d = offset of the plane along them
+// od = offset of the plane from the camera along them
+typedef struct s_planes
+{
+	float			*x;
+	float			*y;
+	float			*z;
+	float			*nx;
+	float			*ny;
+	float			*nz;
+	int				*col;
+	float			*ux;
+	float			*uy;
+	float			*uz;
+	float			*d;
+	float			*od;
+	int				count;
+	int				cap;
+}	t_planes;
+
+// x, y, z = base centers, vx, vy, vz = axes as given, rad = radii,
+// hth = heights
+// ax, ay, az = unit axes, rad2 = squared radii, tx, ty, tz = centers of
+// the top caps, box = bounds
+typedef struct s_cylinders
+{
+	float			*x;
+	float			*y;
+	float			*z;
+	float			*vx;
+	float			*vy;
+	float			*vz;
+	float			*rad;
+	float			*hth;
+	int				*col;
+	float			*ax;
+	float			*ay;
+	float			*az;
+	float			*rad2;
+	float			*tx;
+	float			*ty;
+	float			*tz;
+	t_aabb			*box;
+	int				count;
+	int				cap;
+}	t_cylinders;
 
 // used in cylinder intersection function
 //
@@ -259,6 +376,8 @@ typedef struct s_obj
 // quad = coefficients of quadratic equation
 // hit_point = point on cyl surface where ray intersects
 // hit_base = vector from hit point to the base center of cylinder
+// pos / top = base / top cap centers, rad2 = squared radius,
+// hth = height
 // t0, t1 = possible intersection points
 // disc = discriminant of quadratic equation
 // proj_l = projection of hit_base onto cylinder axis
@@ -272,14 +391,16 @@ typedef struct s_cyl_intersect
 	t_float_3		quad;
 	t_float_3		hit_point;
 	t_float_3		hit_base;
+	t_float_3		pos;
+	t_float_3		top;
 	float			a;
 	float			b;
-	float			c;
 	float			t0;
 	float			t1;
 	float			disc;
 	float			proj_l;
-	float			dia;
+	float			rad2;
+	float			hth;
 	int				hit_cap;
 	int				hit_side;
 }	t_cyl_intersect;
@@ -290,23 +411,200 @@ typedef struct s_ray
 	t_float_3		dir;
 }	t_ray;
 
+// bounding volume hierarchy over spheres and cylinders
+// leaves (left == NULL) hold count objects starting at prims
+// types = mask (1 << type) of the object types below the node
+typedef struct s_bvh_node
+{
+	t_aabb				box;
+	struct s_bvh_node	*left;
+	struct s_bvh_node	*right;
+	int					*prims;
+	int					count;
+	int					types;
+}	t_bvh_node;
+
+// the bvh as traced, the tree is flattened depth first into one array
+// of BVH_ALIGN aligned 32 byte nodes: the left child of an inner node
+// follows it directly, index is its right child. leaves (count > 0)
+// hold the count object ids starting at map->bounded[index]
+typedef struct s_bvh_flat
+{
+	t_aabb			box;
+	int				index;
+	int				count;
+}	t_bvh_flat;
+
+// how the bvh builder splits a node, picked with --bvh
+// middle = center of the longest axis, median = equal halves,
+// sah = binned surface area heuristic
+typedef enum e_bvh_split
+{
+	BVH_MIDDLE,
+	BVH_MEDIAN,
+	BVH_SAH
+}	t_bvh_split;
+
+// what the camera rays search for their closest hit, picked with --accel
+// bvh = traverse the bvh, bins = test the objects binned to their tile
+typedef enum e_accel
+{
+	ACCEL_BVH,
+	ACCEL_BINS
+}	t_accel;
+
+// shape of the last built bvh, cost = expected sah cost of a ray
+// hitting the root, see bvh_measure(), built_cost = cost right after
+// the last build, refits are measured against it in bvh_update()
+typedef struct s_bvh_info
+{
+	t_bvh_split		split;
+	int				nodes;
+	int				leaves;
+	int				depth;
+	double			build_ms;
+	float			cost;
+	float			built_cost;
+	int				refits;
+	int				rebuilds;
+	double			refit_ms;
+}	t_bvh_info;
+
 // main map holding struct
+// version is bumped by every edit of the scene, see render()
+// shape_dirty = mask (1 << type) of the object types edited since the
+// bvh was last fitted, see bvh_update()
+// sp, pl, cy = the objects, see t_spheres
+// bounded = ids of the spheres and cylinders, sorted by the bvh built
+// over them, bvh_types = the types mask of every bvh node, see t_bvh_node
+// planes are infinite and stay out of the bvh, tested one by one
+// the camera ray through pixel x, y points along ray_corner + x * ray_du
+// + y * ray_dv, see camera_prepare()
 typedef struct s_map
 {
 	t_amb			amb;
 	t_cam			cam;
 	t_light			light;
-	t_obj			*objects;
+	t_spheres		sp;
+	t_planes		pl;
+	t_cylinders		cy;
+	int				*bounded;
+	int				num_bounded;
+	t_bvh_flat		*bvh;
+	unsigned char	*bvh_types;
+	int				bvh_nodes;
+	t_bvh_info		bvh_info;
 	float			aspect_ratio;	
 	t_float_3		vec_up;
 	t_float_3		vec_right;
 	float			height;
 	float			width;
+	t_float_3		ray_corner;
+	t_float_3		ray_du;
+	t_float_3		ray_dv;
+	unsigned int	version;
+	int				shape_dirty;
 }	t_map;
 
+// traversal stack depth, the bvh builder never goes deeper than this
+# define BVH_MAX_DEPTH 64
+// objects per bvh leaf
+# define BVH_LEAF_SIZE 4
+// alignment of the flat bvh, two nodes per cache line
+# define BVH_ALIGN 32
+// centroid bins per axis tried by the sah builder
+# define BVH_BINS 16
+// sah cost of stepping through a node and of testing one object
+# define SAH_TRAVERSAL 1.0f
+# define SAH_INTERSECT 2.0f
+// scenes smaller than this build serially, the top BVH_TOP_DEPTH levels
+// of larger ones are split serially and the subtrees below in parallel
+# define BVH_PARALLEL_MIN 4096
+# define BVH_TOP_DEPTH 8
+// refitted trees are rebuilt once their sah cost grew by this factor
+# define BVH_REFIT_LIMIT 1.3f
+
+// primitive as seen by the bvh builder
+typedef struct s_bvh_prim
+{
+	int				id;
+	t_aabb			box;
+	t_float_3		center;
+}	t_bvh_prim;
+
+typedef struct s_bvh_bin
+{
+	t_aabb			box;
+	int				count;
+}	t_bvh_bin;
+
+// best binned split found so far, cbox = box around the centers
+typedef struct s_sah
+{
+	t_aabb			cbox;
+	t_bvh_bin		bins[BVH_BINS];
+	int				total;
+	float			scale;
+	float			cost;
+	int				axis;
+	float			plane;
+}	t_sah;
+
+// subtree left for a worker, built into *slot
+typedef struct s_bvh_task
+{
+	struct s_bvh_node	**slot;
+	int					start;
+	int					count;
+	int					depth;
+}	t_bvh_task;
+
+// refit of the flat bvh, first / end = node ranges of the subtrees
+// refitted by the workers, each into its own sums, gather = 1 while
+// they are being listed, total = sums of the whole tree
+typedef struct s_bvh_refit
+{
+	t_map			*map;
+	int				first[1 << BVH_TOP_DEPTH];
+	int				end[1 << BVH_TOP_DEPTH];
+	float			sums[1 << BVH_TOP_DEPTH][2];
+	float			total[2];
+	int				count;
+	int				next;
+	int				types;
+	int				gather;
+}	t_bvh_refit;
+
+typedef struct s_bvh_build
+{
+	struct s_map	*map;
+	t_bvh_prim		*prims;
+	t_bvh_split		split;
+	int				depth;
+	t_bvh_task		tasks[1 << BVH_TOP_DEPTH];
+	int				num_tasks;
+	int				next_task;
+	int				task_size;
+}	t_bvh_build;
+
+// explicit traversal stack of flat node indices, t = distance at which
+// the ray enters the node
+typedef struct s_bvh_stack
+{
+	t_bvh_flat		*nodes;
+	int				node[BVH_MAX_DEPTH];
+	float			t[BVH_MAX_DEPTH];
+	int				top;
+	t_ray			ray;
+	t_float_3		inv;
+}	t_bvh_stack;
+
+// hit_id = id of the object hit, -1 when the ray hit nothing
+// the search for the closest hit only sets t and hit_id, hit_point,
+// normal and color follow from them, see resolve_hit()
 typedef struct s_trace
 {
-	t_obj		hit_object;
+	int			hit_id;
 	t_ray		ray;
 	t_float_3	intersection;
 	t_float_3	normal;
@@ -315,26 +613,244 @@ typedef struct s_trace
 	float		t;
 }	t_trace;
 
+// 4 floats / 4 lane masks, gcc and clang vector extensions so the same
+// code becomes sse on x86 and neon on arm
+typedef float	t_v4 __attribute__((vector_size(16)));
+typedef int		t_m4 __attribute__((vector_size(16)));
+// 8 wide for the avx2 kernels, the u types load from any float
+typedef float	t_v8 __attribute__((vector_size(32)));
+typedef int		t_m8 __attribute__((vector_size(32)));
+typedef float	t_v4u __attribute__((vector_size(16), aligned(4)));
+typedef float	t_v8u __attribute__((vector_size(32), aligned(4)));
+
+// the ray as the sphere kernels use it, a = the squared length of dir
+typedef struct s_sphere_ray
+{
+	t_float_3		orig;
+	t_float_3		dir;
+	float			a;
+}	t_sphere_ray;
+
+// one ray and one cylinder per lane for the cylinder kernel, o and d =
+// ray origins and directions, p = base centers, a = unit axes, c = top
+// cap centers, x y z per vector
+typedef struct s_cyl_lanes
+{
+	t_v4			o[3];
+	t_v4			d[3];
+	t_v4			p[3];
+	t_v4			a[3];
+	t_v4			c[3];
+	t_v4			rad2;
+	t_v4			hth;
+}	t_cyl_lanes;
+
+// camera rays of a PACKET_W x PACKET_W pixel block traced together
+// through the bvh, 4 rays per vector. packets with fewer than
+// PACKET_MIN_RAYS rays entering the bvh are traced ray by ray instead
+# define PACKET_W 4
+# define PACKET_RAYS 16
+# define PACKET_VECS 4
+# define PACKET_MIN_RAYS 4
+
+// rays of a packet all start at orig, inv = inverse directions per axis,
+// t = distance of the closest hit of every ray, active = mask of the
+// rays in use, the block can be cut off by the edge of the tile,
+// mask = rays the node being visited is tested for
+typedef struct s_packet
+{
+	t_float_3		orig;
+	t_v4			inv[3][PACKET_VECS];
+	t_v4			t[PACKET_VECS];
+	t_ray			ray[PACKET_RAYS];
+	t_trace			hit[PACKET_RAYS];
+	int				active;
+	int				mask;
+}	t_packet;
+
+// shared traversal stack, t = distances at which each ray enters node
+typedef struct s_packet_stack
+{
+	t_bvh_flat		*nodes;
+	int				node[BVH_MAX_DEPTH];
+	t_v4			t[BVH_MAX_DEPTH][PACKET_VECS];
+	int				top;
+}	t_packet_stack;
+
+// job run by every worker of the pool, id = index of the worker
+typedef void	(*t_job)(void *arg, int id);
+
+typedef struct s_worker
+{
+	struct s_pool	*pool;
+	int				id;
+}	t_worker;
+
+// long-lived worker threads created once at startup
+// generation is bumped for every published job, pending counts the
+// workers that did not finish the current job yet
+typedef struct s_pool
+{
+	pthread_t		*threads;
+	t_worker		*workers;
+	int				count;
+	pthread_mutex_t	lock;
+	pthread_cond_t	start;
+	pthread_cond_t	done;
+	t_job			job;
+	void			*arg;
+	unsigned int	generation;
+	int				pending;
+	int				quit;
+}	t_pool;
+
+// pixel rectangle of a tile, x1 and y1 excluded
+typedef struct s_rect
+{
+	int				x0;
+	int				y0;
+	int				x1;
+	int				y1;
+}	t_rect;
+
+// tiles of one worker, owner pops at head, thieves steal at tail
+typedef struct s_deque
+{
+	pthread_mutex_t	lock;
+	int				*tiles;
+	int				head;
+	int				tail;
+}	t_deque;
+
+// per thread counters, busy = seconds spent tracing tiles
+// rays / nodes / tests = camera rays traced, bvh nodes and objects
+// tested, shadow_* the same for shadow rays, occluder_hits = shadow
+// rays blocked by the object that blocked the previous one, packets /
+// packet_nodes = ray packets traced and bvh nodes they visited,
+// fallbacks = packets traced ray by ray
+typedef struct s_tstats
+{
+	double			busy;
+	int				tiles;
+	int				stolen;
+	long			rays;
+	long			nodes;
+	long			tests;
+	long			shadow_rays;
+	long			shadow_nodes;
+	long			shadow_tests;
+	long			occluder_hits;
+	long			packets;
+	long			packet_nodes;
+	long			fallbacks;
+}	t_tstats;
+
+// work stealing tile scheduler, wall = summed frame times
+// gen is bumped to cancel the pass started at generation pass_gen
+typedef struct s_sched
+{
+	t_deque			*queues;
+	t_tstats		*stats;
+	int				*tiles;
+	int				count;
+	int				tile_size;
+	int				tiles_x;
+	int				tiles_y;
+	int				num_tiles;
+	int				step;
+	unsigned int	gen;
+	unsigned int	pass_gen;
+	int				frames;
+	double			wall;
+}	t_sched;
+
+// spheres and cylinders whose projected bounds touch each tile, the ones
+// of tile t are ids[start[t]] up to ids[start[t + 1]], in bvh leaf order
+// rect = x0, x1, y0, y1 tiles of every bounded object, see bins_build()
+typedef struct s_bins
+{
+	int				*start;
+	int				*ids;
+	int				*rect;
+	int				cap;
+}	t_bins;
+
+// command line, threads = 0 picks the count from the machine
+// output = file the headless mode saves the frame to, NULL for a window
+typedef struct s_opts
+{
+	char			*scene;
+	int				threads;
+	int				tile_size;
+	int				pin;
+	int				progressive;
+	int				packets;
+	t_bvh_split		bvh;
+	t_accel			accel;
+	char			*output;
+}	t_opts;
+
+// writes the n colors from src as pixels of the image from dst on,
+// picked once for the image format by row_writer()
+struct	s_win;
+
+typedef void	(*t_row_writer)(struct s_win *win, char *dst, int *src, \
+int n);
+
 // main holding struct
+// img / addr = front and back buffer, frames are traced into img[back]
+// while img[!back] stays on screen
+// to_linear / to_srgb = srgb decoding and encoding tables, see color_init()
+// stats_wanted = P was pressed while a pass was traced, see key_stats()
 typedef struct s_win
 {
 	void			*mlx;
 	void			*win;
-	void			*img;	
-	char			*addr;
+	void			*img[2];
+	char			*addr[2];
+	int				back;
 	int				bpp;
 	int				line_l;
 	int				endian;
+	t_row_writer	put_row;
 	int				num_cores;
 	t_map			*map;
+	t_pool			pool;
+	t_sched			sched;
+	t_opts			opts;
+	t_bins			bins;
+	struct s_ctx	*ctx;
+	unsigned int	drawn_version;
+	long			skipped;
+	int				step;
+	int				preview_step;
+	int				in_flight;
+	int				stats_wanted;
+	double			pass_start;
+	float			to_linear[256];
+	unsigned char	to_srgb[SRGB_LUT_SIZE];
 }	t_win;
 
-typedef struct s_thread
+// per worker render context, the counters it updates are not shared
+// occluder = id of the object that blocked the last shadow ray of the
+// worker, -1 before the first one
+// tile = colors of the tile being rendered, rows of tile_size, copied
+// into the image once the tile is done, see tile_flush()
+// rays = camera rays of the tile row being rendered
+// bin = objects binned to the tile being rendered, bin_count of them,
+// only used with --accel bins
+typedef struct s_ctx
 {
-	t_win	*win;
-	int		start_y;
-	int		end_y;
-}	t_thread;
+	t_win			*win;
+	t_map			*map;
+	t_tstats		*stats;
+	int				id;
+	int				occluder;
+	int				*tile;
+	t_ray			*rays;
+	int				*bin;
+	int				bin_count;
+}	t_ctx;
 
 // controls.c
 int			handle_keypress(int keysym, t_win *win);
@@ -343,6 +859,11 @@ void		handle_keypress_without_angle(int keysym, t_win *win);
 int			handle_destroy_notify(t_win *win);
 int			print_controls(t_win *win);
 
+// controls_keys.c
+int			key_moves(int keysym);
+int			key_rotates(int keysym);
+void		key_stats(t_win *win);
+
 // parser.c
 t_map		*parser(char *filename);
 char		*sanitize(char *line);
@@ -371,7 +892,6 @@ int			is_ulong(char *str);
 // utils_parser.c
 int			open_file(char *filename);
 int			is_rt_file(char *filename);
-void		add_object(t_map *map, t_obj_type type, void *object, int col);
 
 // utils_array.c
 void		free_array(char **arr);
@@ -385,7 +905,7 @@ int			test_parser(t_map *map);
 
 // utils_mem.c
 t_map		*malloc_map(void);
-void		free_objects(t_obj *objects);
+void		free_map(t_map *map);
 int			error_throw(char *msg);
 
 // utils_vec.c
@@ -405,65 +925,289 @@ float		vec_cos(t_float_3 a, t_float_3 b);
 // utils_vec3.c
 t_float_3	vec_negate(t_float_3 vec);
 float		vec_length(t_float_3 vec);
+float		axis_value(t_float_3 v, int axis);
+float		inv_sqrt(float x);
+
+// utils_v4.c
+t_v4		v4_min(t_v4 a, t_v4 b);
+t_v4		v4_max(t_v4 a, t_v4 b);
+float		f_min(float a, float b);
+float		f_max(float a, float b);
+t_v4		v4_reject2(t_v4 *u, t_v4 *v, t_v4 k);
+
+// utils_v4_math.c
+t_v4		v4_sqrt(t_v4 v);
+t_v4		v4_dot(t_v4 *u, t_v4 *v);
+void		v4_cross(t_v4 *res, t_v4 *u, t_v4 *v);
+t_v4		v4_select(t_m4 m, t_v4 a, t_v4 b);
 
 // utils_win.c
 int			ambient_lum(t_map *map);
 void		pixel_to_img(t_win *win, int x, int y, int color);
+void		headless_init(t_win *win);
+
+// window.c
+void		window_init(t_win *win);
+int			handle_expose(t_win *win);
+void		window_present(t_win *win);
+void		run_window(t_win *win);
 
 // utils_col.c
 int			create_color(int r, int g, int b);
 int			rgb_to_hex(int r, int g, int b);
-int			clamp(int value, int min, int max);
 t_int_3		extract_rgb(int col);
 
 // utils_col2.c
-int			add_colors(int col1, int col2);
-int			color_multiply(int color, float ratio);
+int			clamp(int value, int min, int max);
+void		color_init(t_win *win);
+t_v4		color_decode(t_win *win, int col);
+int			color_encode(t_win *win, t_v4 rgb);
 
 // render.c
-t_trace		*closest_obj(t_ray ray, t_trace *closest, t_obj *object);
-void		render_ray(t_win *win, int x, int y);
-void		*threaded_render(void *arg);
+int			render_ray(t_ctx *ctx, t_ray *ray);
+void		render_tile(t_ctx *ctx, int tile);
+void		threaded_render(void *arg, int id);
 int			render(t_win *win);
 
+// render_progressive.c
+void		tile_rect(t_sched *sched, int tile, t_rect *rect);
+void		fill_block(t_ctx *ctx, t_rect *rect, t_int_3 at, int color);
+int			preview_start(t_win *win);
+void		adapt_preview(t_win *win, double ms);
+
+// render_async.c
+void		render_launch(t_win *win, int step);
+int			render_collect(t_win *win);
+void		render_cancel(t_win *win);
+void		render_offline(t_win *win);
+
+// pool.c
+void		pool_init(t_pool *pool, int count);
+void		pool_destroy(t_pool *pool);
+
+// options.c
+int			parse_options(t_opts *opts, int argc, char **argv);
+
+// cpu.c
+int			default_threads(int num_cores);
+
+// cpu_cgroup.c
+int			cgroup_cpus(void);
+
+// cpu_affinity.c
+int			affinity_count(void);
+void		pool_pin(t_pool *pool);
+
+// img_write.c
+t_row_writer	row_writer(t_win *win);
+void		tile_flush(t_ctx *ctx, t_rect *rect);
+
+// img_output.c
+void		put_be32(unsigned char *p, unsigned int v);
+char		*output_path(char *path);
+void		frame_rgb(t_win *win, unsigned char *dst, size_t stride);
+void		image_write(t_win *win, char *path);
+
+// img_png.c
+void		png_write(t_win *win, int fd);
+
+// render_setup.c
+void		render_setup(t_win *win);
+void		render_shutdown(t_win *win);
+
+// sched.c
+void		sched_init(t_sched *sched, int count, int tile_size);
+void		sched_destroy(t_sched *sched);
+void		sched_reset(t_sched *sched);
+
+// sched_next.c
+int			sched_next(t_sched *sched, int id);
+
+// render_stats.c
+void		print_render_stats(t_win *win);
+
+// utils_time.c
+double		time_now(void);
+
+// pool_run.c
+void		pool_launch(t_pool *pool, t_job job, void *arg);
+void		pool_wait(t_pool *pool);
+int			pool_busy(t_pool *pool);
+void		pool_run(t_pool *pool, t_job job, void *arg);
+
+// render_closest.c
+void		record_hit(t_trace *closest, int id, float t);
+void		closest_planes(t_ctx *ctx, t_ray ray, t_trace *closest);
+t_trace		*closest_obj(t_ctx *ctx, t_ray ray, t_trace *closest);
+int			obscured(t_ctx *ctx, t_ray *ray, float max_dist);
+
+// packet_box.c
+int			packet_box(t_packet *pk, t_aabb *box, t_v4 *entry);
+int			lanes_below(t_v4 *a, t_v4 *b);
+
+// packet_traverse.c
+void		packet_closest(t_ctx *ctx, t_packet *pk);
+
+// packet_leaf.c
+void		leaf_packet(t_ctx *ctx, t_packet *pk, int *ids, int count);
+
+// render_packet.c
+void		render_packets(t_ctx *ctx, int tile);
+
+// bvh_bounds.c
+t_aabb		aabb_empty(void);
+t_aabb		aabb_union(t_aabb a, t_aabb b);
+t_aabb		obj_bounds(t_map *map, int id);
+t_float_3	aabb_center(t_aabb box);
+
+// scene_collect.c
+void		collect_objects(t_map *map);
+
+// scene_prepare.c
+void		scene_prepare(t_map *map, int types);
+
+// scene_free.c
+void		scene_free(t_map *map);
+
+// scene_compile.c
+void		scene_compile(t_map *map);
+
+// scene_add.c
+void		scene_add_sphere(t_map *map, t_sp *sp);
+void		scene_add_plane(t_map *map, t_pl *pl);
+void		scene_add_cylinder(t_map *map, t_cy *cy);
+
+// scene_grow.c
+void		grow_spheres(t_spheres *sp);
+void		grow_planes(t_planes *pl);
+void		grow_cylinders(t_cylinders *cy);
+
+// scene_get.c
+t_float_3	sphere_center(t_spheres *sp, int i);
+t_cy		cylinder_at(t_cylinders *cy, int i);
+void		cylinder_store(t_cylinders *cy, int i, t_cy *c);
+int			obj_run(int *ids, int count);
+int			run_nearest(t_map *map, int *ids, int count, t_trace *closest);
+
+// sphere_kernel.c
+void		sphere_ray(t_sphere_ray *r, t_ray *ray);
+void		lanes_pick(float *t, int id, int lanes, t_trace *closest);
+int			spheres_nearest4(t_spheres *sp, int first, int count, \
+t_trace *closest);
+
+// cylinder_kernel.c
+t_v4		cyl_t4(t_cyl_lanes *l);
+int			cylinders_nearest(t_cylinders *cy, int first, int count, \
+t_trace *closest);
+
+// sphere_kernel_avx.c
+int			spheres_nearest8(t_spheres *sp, int first, int count, \
+t_trace *closest);
+t_sphere_kernel	sphere_kernel(void);
+
+// bvh_split.c
+t_aabb		range_bounds(t_bvh_prim *prims, int count);
+float		aabb_area(t_aabb box);
+int			centroid_bounds(t_bvh_prim *prims, int count, t_aabb *cbox);
+int			partition_axis(t_bvh_prim *prims, int count, int axis, float plane);
+int			split_middle(t_bvh_prim *prims, int count);
+
+// bvh_median.c
+int			split_median(t_bvh_prim *prims, int count);
+
+// bvh_sah.c
+int			split_sah(t_bvh_prim *prims, int count, t_aabb *box);
+
+// bvh_build.c
+int			split_range(t_bvh_build *b, t_bvh_prim *prims, int count, \
+t_aabb *box);
+t_bvh_node	*bvh_new_node(t_bvh_build *b, int start, int count);
+t_bvh_node	*build_node(t_bvh_build *b, int start, int count, int depth);
+void		bvh_build(t_map *map, t_pool *pool);
+
+// bvh_parallel.c
+t_bvh_node	*bvh_build_parallel(t_bvh_build *b, t_pool *pool);
+float		bvh_refit_parallel(t_map *map, t_pool *pool);
+
+// bvh_refit.c
+void		bvh_refit_range(t_bvh_refit *r, int first, int end, float *sums);
+void		bvh_refit_top(t_bvh_refit *r, int node, int depth, int end);
+float		bvh_cost(t_aabb *root, float *sums);
+void		bvh_update(t_map *map, t_pool *pool);
+
+// bvh_flat.c
+void		bvh_flatten(t_map *map, t_bvh_node *root);
+void		bvh_flat_free(t_map *map);
+
+// bvh_report.c
+void		bvh_measure(t_map *map, t_bvh_node *root);
+void		bvh_print(t_map *map);
+t_bvh_split	bvh_split_by_name(char *name);
+void		bvh_free(t_bvh_node *node);
+
+// bvh_ray.c
+float		ray_box(t_ray *ray, t_float_3 inv, t_aabb *box, float max_t);
+float		inv_dir(float d);
+void		bvh_stack_init(t_bvh_stack *st, t_ray *ray, t_map *map);
+void		bvh_push_children(t_bvh_stack *st, int node);
+
+// bvh_traverse.c
+void		bvh_closest(t_ctx *ctx, t_ray ray, t_trace *closest);
+int			bvh_occluded(t_ctx *ctx, t_ray *ray, float max_dist);
+void		leaf_closest(t_ctx *ctx, t_trace *closest, int *ids, int count);
+
+// bins.c
+void		bins_build(t_win *win);
+void		bins_select(t_ctx *ctx, int tile);
+t_accel		accel_by_name(char *name);
+
+// bins_project.c
+void		obj_tiles(t_win *win, int id, int *r);
+
 // render_normal.c
-t_float_3	sphere_normal(t_trace *inter);
-t_float_3	cylinder_normal(t_trace *inter, t_ray ray);
-t_float_3	plane_normal(t_trace *inter, t_ray ray);
-t_float_3	shape_normal(t_trace *inter, t_ray ray);
+t_float_3	sphere_normal(t_map *map, t_trace *inter);
+t_float_3	cylinder_normal(t_map *map, t_trace *inter);
+t_float_3	plane_normal(t_map *map, t_trace *inter, t_ray ray);
+t_float_3	shape_normal(t_map *map, t_trace *inter, t_ray ray);
+void		resolve_hit(t_map *map, t_trace *closest);
 
 // render_view.c
 void		camera_init(t_map *map);
-t_float_3	pixels_to_viewport(int x, int y);
-t_ray		throw_ray(t_map *map, t_float_3 vec);
+
+// camera_rays.c
+void		camera_prepare(t_map *map);
+void		camera_row(t_map *map, t_int_3 at, int n, t_ray *rays);
+
+// render_primary.c
+void		scene_view(t_map *map);
+int			sphere_primary(t_ray ray, t_spheres *sp, int i, float *t);
+int			plane_primary(t_ray ray, t_planes *pl, int i, float *t);
+int			intersect_primary(t_map *map, t_ray ray, int id, float *t);
 
 // render_intersects.c
-int			intersect(t_ray ray, t_obj *obj, float *t);
-int			sphere_intersect(t_ray ray, t_sp *sphere, float *t);
-int			plane_intersect(t_ray ray, t_pl *plane, float *t);
+int			intersect(t_map *map, t_ray ray, int id, float *t);
+int			sphere_intersect(t_ray ray, t_spheres *sp, int i, float *t);
+int			quad_roots(t_cyl_intersect *vars, t_float_3 u, t_float_3 v, \
+float r2);
+int			sphere_roots(t_cyl_intersect *vars, float *t);
+int			plane_intersect(t_ray ray, t_planes *pl, int i, float *t);
 
 // render_intersect_cylinders.c
-int			cylinder_intersect(t_ray ray, t_cy *cylinder, float *t);
-int			is_valid_intersect(t_cyl_intersect *vars, \
-t_cy *cylinder, t_ray ray, float *t);
-int			hit_cyl_side(t_ray ray, t_cy *cylinder, \
-t_cyl_intersect *vars, float *t);
-int			hit_cyl_cap(t_ray ray, t_cy *cylinder, \
-t_cyl_intersect *vars, float *t);
+int			cylinder_intersect(t_ray ray, t_cylinders *cy, int i, float *t);
+int			hit_cyl_side(t_ray ray, t_cyl_intersect *vars, float *t);
+int			hit_cyl_cap(t_ray ray, t_cyl_intersect *vars, float *t);
 int			intersect_disk(t_ray ray, t_float_3 disk_center, \
 t_cyl_intersect *vars, float *t);
 
 // render_illuminate.c
-void		illuminate(t_map *map, t_trace *closest);
-int			diffuse(t_map *map, t_trace *closest, float intensity);
-int			calculate_shadow(t_map *map, t_trace *closest);
-int			obscured(t_map *map, t_ray *ray, t_obj *closest, float max_dist);
+void		illuminate(t_ctx *ctx, t_trace *closest);
+float		diffuse(t_map *map, t_trace *closest, float intensity);
+int			calculate_shadow(t_ctx *ctx, t_trace *closest);
 
 // translate_object.c
-void		translate_object_x(t_obj *obj, float translation);
-void		translate_object_y(t_obj *obj, float translation);
-void		translate_object_z(t_obj *obj, float translation);
-void		translate_object(t_obj *obj, float translation, char axis);
+void		translate_object_x(t_map *map, float translation);
+void		translate_object_y(t_map *map, float translation);
+void		translate_object_z(t_map *map, float translation);
 void		translate_objects(t_win *win, float translation, char axis);
 
 // move_features.c
@@ -481,7 +1225,7 @@ void		perform_rotation(t_cy *cylinder, t_quat q);
 // rotation_objects.c
 void		perform_plane_rotation(t_pl *plane, t_quat q);
 void		perform_cylinder_rotation(t_cy *cylinder, t_quat q);
-void		rotate_object(t_obj *obj, t_quat q);
+void		rotate_object(t_map *map, int id, t_quat q);
 void		rotate_cylinder(t_win *win, int keysym, float angle);
 void		rotate_plane(t_win *win, int keysym, float angle);
 
@@ -495,6 +1239,7 @@ void		perform_camera_rotation(t_win *win, t_quat q);
 void		rotate_camera(t_win *win, int keysym, float angle);
 
 // resize_objects.c
+void		resize_object(t_map *map, float scale_factor);
 void		resize_objects(t_win *win, int keysym);
 
 #endif
\ No newline at end of file
@@ -6,7 +6,7 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/09/12 17:58:03 by khlavaty          #+#    #+#             */
-/*   Updated: 2024/09/12 18:00:08 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 10:45:16 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -42,6 +42,7 @@ void	move_light(t_win *win, int keysym)
 		win->map->light.pos.z -= 0.1;
 	else if (keysym == KEY_O)
 		win->map->light.pos.z += 0.1;
+	win->map->version++;
 }
 
 void	move_camera(t_win *win, int keysym)
@@ -58,4 +59,5 @@ void	move_camera(t_win *win, int keysym)
 		win->map->cam.pos.z -= 0.1;
 	else if (keysym == KEY_Y)
 		win->map->cam.pos.z += 0.1;
+	win->map->version++;
 }
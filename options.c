@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:24:15 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:59:11 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// strictly positive integer option, anything else or above max is fatal
+static int	option_int(char *str, int max)
+{
+	int	value;
+
+	if (!str || !*str || !is_ulong(str) || ft_strlen(str) > 9)
+		error_throw("Invalid option value");
+	value = ft_atoi(str);
+	if (value < 1 || value > max)
+		error_throw("Option value out of range");
+	return (value);
+}
+
+// MINIRT_THREADS=N and MINIRT_PIN=1 act as defaults for the flags
+static void	env_options(t_opts *opts)
+{
+	char	*env;
+
+	env = getenv("MINIRT_THREADS");
+	if (env && *env)
+		opts->threads = option_int(env, MAX_THREADS);
+	env = getenv("MINIRT_PIN");
+	if (env && *env && *env != '0')
+		opts->pin = 1;
+}
+
+// options taking a value, returns the number of arguments consumed
+static int	option_value(t_opts *opts, char *flag, char *value)
+{
+	if (!value)
+		return (0);
+	if (!ft_strncmp(flag, "--threads", 10))
+		opts->threads = option_int(value, MAX_THREADS);
+	else if (!ft_strncmp(flag, "--tile", 7))
+		opts->tile_size = option_int(value, WINDOW_WIDTH);
+	else if (!ft_strncmp(flag, "--bvh", 6))
+		opts->bvh = bvh_split_by_name(value);
+	else if (!ft_strncmp(flag, "--accel", 8))
+		opts->accel = accel_by_name(value);
+	else if (!ft_strncmp(flag, "--output", 9))
+		opts->output = output_path(value);
+	else
+		return (0);
+	return (2);
+}
+
+static int	option_flag(t_opts *opts, char *flag)
+{
+	if (!ft_strncmp(flag, "--pin", 6))
+		opts->pin = 1;
+	else if (!ft_strncmp(flag, "--no-progressive", 17))
+		opts->progressive = 0;
+	else if (!ft_strncmp(flag, "--no-packets", 13))
+		opts->packets = 0;
+	else
+		return (0);
+	return (1);
+}
+
+// ./miniRT <scene.rt> [--threads N] [--tile N] [--bvh SPLIT]
+//          [--accel bvh|bins] [--output FILE] [--pin] [--no-progressive]
+//          [--no-packets]
+// threads = 0 means one thread per cpu available to the process
+// returns 1 if the command line is not valid
+int	parse_options(t_opts *opts, int argc, char **argv)
+{
+	int	i;
+	int	used;
+
+	ft_bzero(opts, sizeof(t_opts));
+	opts->tile_size = TILE_SIZE;
+	opts->progressive = 1;
+	opts->packets = 1;
+	opts->bvh = BVH_SAH;
+	env_options(opts);
+	i = 1;
+	while (i < argc)
+	{
+		used = option_flag(opts, argv[i]);
+		if (!used)
+			used = option_value(opts, argv[i], argv[i + 1]);
+		if (!used && !opts->scene && argv[i][0] != '-')
+		{
+			opts->scene = argv[i];
+			used = 1;
+		}
+		if (!used)
+			return (1);
+		i += used;
+	}
+	return (opts->scene == NULL);
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_box.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:38:26 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 14:17:03 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// ray_box() for the 4 rays of vector v of the packet, INFINITY for the
+// rays missing the box
+static t_v4	box_entry(t_packet *pk, t_aabb *box, int v)
+{
+	t_v4	a;
+	t_v4	b;
+	t_v4	near;
+	t_v4	far;
+	t_m4	miss;
+
+	a = (box->min.x - pk->orig.x) * pk->inv[0][v];
+	b = (box->max.x - pk->orig.x) * pk->inv[0][v];
+	near = v4_min(a, b);
+	far = v4_max(a, b);
+	a = (box->min.y - pk->orig.y) * pk->inv[1][v];
+	b = (box->max.y - pk->orig.y) * pk->inv[1][v];
+	near = v4_max(near, v4_min(a, b));
+	far = v4_min(far, v4_max(a, b));
+	a = (box->min.z - pk->orig.z) * pk->inv[2][v];
+	b = (box->max.z - pk->orig.z) * pk->inv[2][v];
+	near = v4_max(v4_max(near, v4_min(a, b)), (t_v4){0.0f, 0.0f, 0.0f, 0.0f});
+	far = v4_min(far, v4_max(a, b));
+	miss = far < near;
+	a = (t_v4){INFINITY, INFINITY, INFINITY, INFINITY};
+	return ((t_v4)(((t_m4)near & ~miss) | ((t_m4)a & miss)));
+}
+
+// bit mask of the packet rays with a[ray] < b[ray]
+int	lanes_below(t_v4 *a, t_v4 *b)
+{
+	t_m4	m;
+	int		mask;
+	int		v;
+
+	mask = 0;
+	v = 0;
+	while (v < PACKET_VECS)
+	{
+		m = a[v] < b[v];
+		mask |= ((m[0] & 1) | (m[1] & 2) | (m[2] & 4) | (m[3] & 8)) << (v * 4);
+		v++;
+	}
+	return (mask);
+}
+
+// slab test of the whole packet against box, entry = distance at which
+// every ray enters it, returns the active rays entering it before their
+// closest hit so far
+int	packet_box(t_packet *pk, t_aabb *box, t_v4 *entry)
+{
+	int	v;
+
+	v = 0;
+	while (v < PACKET_VECS)
+	{
+		entry[v] = box_entry(pk, box, v);
+		v++;
+	}
+	return (lanes_below(entry, pk->t) & pk->active);
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_leaf.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:57:44 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:20:05 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// cylinder i in every lane, rays from orig
+static void	cyl_lanes_one(t_cyl_lanes *l, t_cylinders *cy, int i, \
+t_float_3 orig)
+{
+	l->o[0] = (t_v4){} + orig.x;
+	l->o[1] = (t_v4){} + orig.y;
+	l->o[2] = (t_v4){} + orig.z;
+	l->p[0] = (t_v4){} + cy->x[i];
+	l->p[1] = (t_v4){} + cy->y[i];
+	l->p[2] = (t_v4){} + cy->z[i];
+	l->a[0] = (t_v4){} + cy->ax[i];
+	l->a[1] = (t_v4){} + cy->ay[i];
+	l->a[2] = (t_v4){} + cy->az[i];
+	l->c[0] = (t_v4){} + cy->tx[i];
+	l->c[1] = (t_v4){} + cy->ty[i];
+	l->c[2] = (t_v4){} + cy->tz[i];
+	l->rad2 = (t_v4){} + cy->rad2[i];
+	l->hth = (t_v4){} + cy->hth[i];
+}
+
+// directions of the rays of vector v of the packet into the lanes
+static void	cyl_lanes_dirs(t_cyl_lanes *l, t_packet *pk, int v)
+{
+	int	k;
+
+	k = -1;
+	while (++k < 4)
+	{
+		l->d[0][k] = pk->ray[4 * v + k].dir.x;
+		l->d[1][k] = pk->ray[4 * v + k].dir.y;
+		l->d[2][k] = pk->ray[4 * v + k].dir.z;
+	}
+}
+
+// one cylinder against the rays in pk->mask, 4 rays per kernel call
+static int	packet_cylinder(t_packet *pk, t_map *map, int id)
+{
+	t_cyl_lanes	l;
+	t_v4		t;
+	int			v;
+	int			k;
+
+	cyl_lanes_one(&l, &map->cy, id >> OBJ_TYPE_BITS, pk->orig);
+	v = -1;
+	while (++v < PACKET_VECS)
+	{
+		if (!((pk->mask >> (4 * v)) & 15))
+			continue ;
+		cyl_lanes_dirs(&l, pk, v);
+		t = cyl_t4(&l);
+		k = -1;
+		while (++k < 4)
+		{
+			if ((pk->mask >> (4 * v + k) & 1) && t[k] < pk->hit[4 * v + k].t)
+			{
+				record_hit(&pk->hit[4 * v + k], id, t[k]);
+				pk->t[v][k] = t[k];
+			}
+		}
+	}
+	return (1);
+}
+
+// the object or run of objects at ids against the rays in pk->mask, a
+// lone cylinder goes through the kernel 4 rays at a time, the rest ray
+// by ray. returns how many objects were tested
+static int	packet_objects(t_packet *pk, t_map *map, int *ids, int count)
+{
+	float	t;
+	int		lanes;
+	int		lane;
+	int		n;
+
+	n = obj_run(ids, count);
+	if (n == 1 && (ids[0] & OBJ_TYPE_MASK) == CYLINDER)
+		return (packet_cylinder(pk, map, ids[0]));
+	lanes = pk->mask;
+	while (lanes)
+	{
+		lane = __builtin_ctz(lanes);
+		lanes &= lanes - 1;
+		if (n)
+			run_nearest(map, ids, n, &pk->hit[lane]);
+		else if (intersect_primary(map, pk->ray[lane], ids[0], &t)
+			&& t < pk->hit[lane].t)
+			record_hit(&pk->hit[lane], ids[0], t);
+		pk->t[lane / 4][lane % 4] = pk->hit[lane].t;
+	}
+	return (n + (n == 0));
+}
+
+// the count objects of ids, a leaf or a tile bin, against the rays of
+// the packet in pk->mask
+void	leaf_packet(t_ctx *ctx, t_packet *pk, int *ids, int count)
+{
+	int		n;
+	int		i;
+
+	i = 0;
+	while (i < count)
+	{
+		n = packet_objects(pk, ctx->map, ids + i, count - i);
+		ctx->stats->tests += n * __builtin_popcount(pk->mask);
+		i += n;
+	}
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_traverse.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:40:03 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:20:05 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+static void	packet_push(t_packet_stack *st, int node, t_v4 *entry)
+{
+	int	v;
+
+	st->node[st->top] = node;
+	v = -1;
+	while (++v < PACKET_VECS)
+		st->t[st->top][v] = entry[v];
+	st->top++;
+}
+
+// pushes the children entered by any ray, the one the first of those
+// rays enters first goes on top
+static void	packet_children(t_packet *pk, t_packet_stack *st, int node)
+{
+	t_v4	tl[PACKET_VECS];
+	t_v4	tr[PACKET_VECS];
+	int		ml;
+	int		mr;
+	int		lane;
+
+	ml = packet_box(pk, &st->nodes[node + 1].box, tl);
+	mr = packet_box(pk, &st->nodes[st->nodes[node].index].box, tr);
+	if (!(ml | mr))
+		return ;
+	lane = __builtin_ctz(ml | mr);
+	if (tl[lane / 4][lane % 4] <= tr[lane / 4][lane % 4])
+	{
+		if (mr)
+			packet_push(st, st->nodes[node].index, tr);
+		if (ml)
+			packet_push(st, node + 1, tl);
+		return ;
+	}
+	if (ml)
+		packet_push(st, node + 1, tl);
+	if (mr)
+		packet_push(st, st->nodes[node].index, tr);
+}
+
+// rays the packet lost on the way in are traced alone, the bvh only
+// pays off for packets while most of their rays stay together
+static int	packet_root(t_ctx *ctx, t_packet *pk, t_packet_stack *st)
+{
+	t_v4	entry[PACKET_VECS];
+	int		mask;
+	int		lane;
+
+	st->top = 0;
+	mask = packet_box(pk, &ctx->map->bvh->box, entry);
+	if (__builtin_popcount(mask) >= PACKET_MIN_RAYS)
+	{
+		packet_push(st, 0, entry);
+		return (1);
+	}
+	if (mask)
+		ctx->stats->fallbacks++;
+	while (mask)
+	{
+		lane = __builtin_ctz(mask);
+		mask &= mask - 1;
+		bvh_closest(ctx, pk->ray[lane], &pk->hit[lane]);
+	}
+	return (0);
+}
+
+// closest sphere or cylinder hit of every active ray of the packet,
+// nodes are visited once for all the rays still entering them before
+// their closest hit, the planes have been tested already
+void	packet_closest(t_ctx *ctx, t_packet *pk)
+{
+	t_packet_stack	st;
+	t_bvh_flat		*node;
+
+	if (!ctx->map->bvh)
+		return ;
+	ctx->stats->packets++;
+	st.nodes = ctx->map->bvh;
+	if (!packet_root(ctx, pk, &st))
+		return ;
+	while (st.top > 0)
+	{
+		st.top--;
+		pk->mask = lanes_below(st.t[st.top], pk->t) & pk->active;
+		if (!pk->mask)
+			continue ;
+		node = &st.nodes[st.node[st.top]];
+		ctx->stats->packet_nodes++;
+		if (node->count)
+			leaf_packet(ctx, pk, ctx->map->bounded + node->index,
+				node->count);
+		else
+			packet_children(pk, &st, st.node[st.top]);
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/02/22 09:48:04 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/14 15:20:23 by fvonsovs         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:39:52 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -33,6 +33,7 @@ t_map	*parser(char *filename)
 		line = get_next_line(fd);
 	}
 	close(fd);
+	scene_prepare(map, OBJ_ALL_TYPES);
 	return (map);
 }
 
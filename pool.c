@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:00:00 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:58:02 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// sleeps on the start condition until a new generation of work is
+// published, returns 0 when the pool is shutting down, called locked
+static int	pool_next(t_pool *pool, unsigned int *seen, t_job *job, \
+void **arg)
+{
+	while (!pool->quit && pool->generation == *seen)
+		pthread_cond_wait(&pool->start, &pool->lock);
+	if (pool->quit)
+		return (0);
+	*seen = pool->generation;
+	*job = pool->job;
+	*arg = pool->arg;
+	return (1);
+}
+
+// worker main loop, runs every published job and reports back
+// on the done condition once the last worker finished it
+static void	*pool_worker(void *arg)
+{
+	t_worker		*self;
+	t_pool			*pool;
+	unsigned int	seen;
+	t_job			job;
+	void			*job_arg;
+
+	self = (t_worker *)arg;
+	pool = self->pool;
+	seen = 0;
+	pthread_mutex_lock(&pool->lock);
+	while (pool_next(pool, &seen, &job, &job_arg))
+	{
+		pthread_mutex_unlock(&pool->lock);
+		job(job_arg, self->id);
+		pthread_mutex_lock(&pool->lock);
+		pool->pending--;
+		if (pool->pending == 0)
+			pthread_cond_broadcast(&pool->done);
+	}
+	pthread_mutex_unlock(&pool->lock);
+	return (NULL);
+}
+
+// spawns count long-lived workers, done once at startup
+void	pool_init(t_pool *pool, int count)
+{
+	int	i;
+
+	ft_bzero(pool, sizeof(t_pool));
+	pool->count = count;
+	pool->threads = malloc(sizeof(pthread_t) * count);
+	pool->workers = malloc(sizeof(t_worker) * count);
+	if (!pool->threads || !pool->workers)
+		error_throw("Cannot allocate thread pool");
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->start, NULL);
+	pthread_cond_init(&pool->done, NULL);
+	i = 0;
+	while (i < count)
+	{
+		pool->workers[i].pool = pool;
+		pool->workers[i].id = i;
+		if (pthread_create(&pool->threads[i], NULL, pool_worker, \
+			&pool->workers[i]) != 0)
+			error_throw("Cannot create render thread");
+		i++;
+	}
+}
+
+// waits for the running job, wakes every worker up to quit and joins them
+void	pool_destroy(t_pool *pool)
+{
+	int	i;
+
+	if (!pool->threads)
+		return ;
+	pool_wait(pool);
+	pthread_mutex_lock(&pool->lock);
+	pool->quit = 1;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+	i = 0;
+	while (i < pool->count)
+		pthread_join(pool->threads[i++], NULL);
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->start);
+	pthread_cond_destroy(&pool->done);
+	free(pool->threads);
+	free(pool->workers);
+	pool->threads = NULL;
+	pool->workers = NULL;
+}
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_run.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:01:37 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:58:02 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// publishes a job to every worker of the pool and returns immediately
+// job(arg, id) is called once per worker, id in range 0 .. count - 1
+// a job still in flight is waited for first, jobs never overlap
+void	pool_launch(t_pool *pool, t_job job, void *arg)
+{
+	pthread_mutex_lock(&pool->lock);
+	while (pool->pending > 0)
+		pthread_cond_wait(&pool->done, &pool->lock);
+	pool->job = job;
+	pool->arg = arg;
+	pool->pending = pool->count;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+}
+
+// blocks until every worker finished the last launched job
+void	pool_wait(t_pool *pool)
+{
+	pthread_mutex_lock(&pool->lock);
+	while (pool->pending > 0)
+		pthread_cond_wait(&pool->done, &pool->lock);
+	pthread_mutex_unlock(&pool->lock);
+}
+
+// non blocking check whether the last launched job is still running
+int	pool_busy(t_pool *pool)
+{
+	int	busy;
+
+	pthread_mutex_lock(&pool->lock);
+	busy = pool->pending > 0;
+	pthread_mutex_unlock(&pool->lock);
+	return (busy);
+}
+
+// runs a job on the whole pool and waits for it to complete
+void	pool_run(t_pool *pool, t_job job, void *arg)
+{
+	pool_launch(pool, job, arg);
+	pool_wait(pool);
+}
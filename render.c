@@ -6,98 +6,104 @@
 /*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/12 15:00:19 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/14 14:40:56 by fvonsovs         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:20:05 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
-t_trace	*closest_obj(t_ray ray, t_trace *closest, t_obj *object)
+int	render_ray(t_ctx *ctx, t_ray *ray)
 {
-	float	t;
+	t_trace		closest;
 
-	closest->t = INFINITY;
-	closest->hit_object.object = NULL;
-	closest->color = 0x000000;
-	t = INFINITY;
-	while (object)
-	{
-		if (intersect(ray, object, &t) && t < closest->t)
-		{
-			closest->t = t;
-			closest->hit_object = *object;
-			closest->ray = ray;
-			closest->hit_point = vec_add(ray.orig, \
-				vec_mul(ray.dir, closest->t));
-			closest->normal = shape_normal(closest, ray);
-			closest->color = closest->hit_object.color;
-		}
-		object = object->next;
-	}
-	if (closest->hit_object.object != NULL)
-		return (closest);
-	return (NULL);
+	if (closest_obj(ctx, *ray, &closest))
+		illuminate(ctx, &closest);
+	return (closest.color);
 }
 
-void	render_ray(t_win *win, int x, int y)
+// traces one pixel per step x step block of the tile and fills the block
+// with it, step 1 is the full resolution pass. the camera rays come a row
+// at a time, the tile is put together in the buffer of the worker and
+// copied into the image in one go
+void	render_tile(t_ctx *ctx, int tile)
 {
-	t_ray		ray;
-	t_trace		closest;
-	t_float_3	vec;
+	t_rect	rect;
+	t_int_3	at;
+	int		step;
+	int		k;
 
-	vec = pixels_to_viewport(x, y);
-	ray = throw_ray(win->map, vec);
-	if (closest_obj(ray, &closest, win->map->objects))
-		illuminate(win->map, &closest);
-	pixel_to_img(win, x, y, closest.color);
+	tile_rect(&ctx->win->sched, tile, &rect);
+	step = ctx->win->sched.step;
+	at.z = step;
+	at.y = rect.y0;
+	while (at.y < rect.y1)
+	{
+		camera_row(ctx->map, (t_int_3){rect.x0, at.y, step},
+			(rect.x1 - rect.x0 + step - 1) / step, ctx->rays);
+		at.x = rect.x0;
+		k = 0;
+		while (at.x < rect.x1)
+		{
+			fill_block(ctx, &rect, at, render_ray(ctx, &ctx->rays[k++]));
+			at.x += step;
+		}
+		at.y += step;
+	}
+	tile_flush(ctx, &rect);
 }
 
-void	*threaded_render(void *arg)
+// worker id pulls tiles until its deque and every other one is empty,
+// or until the pass gets cancelled, which is checked once per tile
+void	threaded_render(void *arg, int id)
 {
-	t_thread	*data;
-	int			x;
-	int			y;
+	t_win		*win;
+	t_ctx		*ctx;
+	double		start;
+	int			tile;
 
-	data = (t_thread *)arg;
-	y = data->start_y;
-	while (y < data->end_y)
+	win = (t_win *)arg;
+	ctx = &win->ctx[id];
+	tile = sched_next(&win->sched, id);
+	while (tile >= 0 && __atomic_load_n(&win->sched.gen, __ATOMIC_ACQUIRE)
+		== win->sched.pass_gen)
 	{
-		x = 0;
-		while (x < WINDOW_WIDTH)
-		{
-			render_ray(data->win, x, y);
-			x++;
-		}
-		y++;
+		start = time_now();
+		bins_select(ctx, tile);
+		if (win->sched.step == 1 && win->opts.packets)
+			render_packets(ctx, tile);
+		else
+			render_tile(ctx, tile);
+		ctx->stats->busy += time_now() - start;
+		ctx->stats->tiles++;
+		tile = sched_next(&win->sched, id);
 	}
-	return (NULL);
 }
 
+// frames are traced on the pool in the background while the event loop
+// keeps running, this hook only collects finished passes and starts new
+// ones. an edit restarts the progressive refinement from the coarse
+// preview, every pass then halves the block size until the full
+// resolution is on screen, after that the hook sleeps until the next edit
 int	render(t_win *win)
 {
-	pthread_t	threads[NUM_THREADS];
-	t_thread	thread_data[NUM_THREADS];
-	int			rows;
-	int			i;
-
-	i = 0;
-	rows = WINDOW_HEIGHT / NUM_THREADS;
-	while (i < NUM_THREADS)
+	if (win->in_flight && !render_collect(win))
+		return (0);
+	if (win->drawn_version != win->map->version)
 	{
-		thread_data[i].win = win;
-		thread_data[i].start_y = i * rows;
-		thread_data[i].end_y = (i + 1) * rows;
-		if (i == NUM_THREADS - 1)
-			thread_data[i].end_y = WINDOW_HEIGHT;
-		pthread_create(&threads[i], NULL, threaded_render, &thread_data[i]);
-		i++;
+		win->drawn_version = win->map->version;
+		if (win->map->shape_dirty)
+			bvh_update(win->map, &win->pool);
+		scene_view(win->map);
+		if (win->opts.accel == ACCEL_BINS)
+			bins_build(win);
+		win->step = preview_start(win);
 	}
-	i = 0;
-	while (i < NUM_THREADS)
+	else if (win->step == 0)
 	{
-		pthread_join(threads[i], NULL);
-		i++;
+		win->skipped++;
+		usleep(IDLE_SLEEP_US);
+		return (0);
 	}
-	mlx_put_image_to_window(win->mlx, win->win, win->img, 0, 0);
+	render_launch(win, win->step);
 	return (0);
 }
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_async.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:59:49 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:36:44 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// starts tracing a pass into the back buffer and returns right away
+void	render_launch(t_win *win, int step)
+{
+	win->sched.step = step;
+	win->sched.pass_gen = __atomic_load_n(&win->sched.gen, __ATOMIC_ACQUIRE);
+	sched_reset(&win->sched);
+	win->pass_start = time_now();
+	win->in_flight = 1;
+	pool_launch(&win->pool, threaded_render, win);
+}
+
+// shows the finished back buffer and swaps the buffers
+static void	render_present(t_win *win, double elapsed)
+{
+	window_present(win);
+	win->back = !win->back;
+	win->sched.wall += elapsed;
+	win->sched.frames++;
+	if (win->opts.progressive && win->step == win->preview_step)
+		adapt_preview(win, elapsed * 1000.0);
+	win->step /= 2;
+}
+
+// returns 0 while the pass is still being traced, 1 once it is over
+// a cancelled pass is thrown away, the back buffer is never shown. the
+// stats asked for with P during the pass are printed now
+int	render_collect(t_win *win)
+{
+	if (pool_busy(&win->pool))
+	{
+		usleep(POLL_SLEEP_US);
+		return (0);
+	}
+	win->in_flight = 0;
+	if (win->sched.pass_gen == win->sched.gen)
+		render_present(win, time_now() - win->pass_start);
+	if (win->stats_wanted)
+	{
+		win->stats_wanted = 0;
+		print_render_stats(win);
+	}
+	return (1);
+}
+
+// makes the workers drop the pass after their current tile and waits
+// for them, the scene is safe to modify when this returns
+void	render_cancel(t_win *win)
+{
+	__atomic_add_fetch(&win->sched.gen, 1, __ATOMIC_RELEASE);
+	pool_wait(&win->pool);
+}
+
+// --output: a single full resolution pass traced on the pool and waited
+// for, then saved, no window and no preview
+void	render_offline(t_win *win)
+{
+	win->drawn_version = win->map->version;
+	scene_view(win->map);
+	if (win->opts.accel == ACCEL_BINS)
+		bins_build(win);
+	render_launch(win, 1);
+	pool_wait(&win->pool);
+	win->in_flight = 0;
+	win->sched.wall += time_now() - win->pass_start;
+	win->sched.frames++;
+	image_write(win, win->opts.output);
+	free(win->addr[0]);
+	win->addr[0] = NULL;
+	win->addr[1] = NULL;
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_closest.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:20:50 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:00:21 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// keeps the hit as the closest one found so far, only its distance and
+// object, the rest is worked out once the search is over, see resolve_hit()
+void	record_hit(t_trace *closest, int id, float t)
+{
+	closest->t = t;
+	closest->hit_id = id;
+}
+
+// starts the closest hit search of a camera ray with the planes, they
+// are tested one by one
+void	closest_planes(t_ctx *ctx, t_ray ray, t_trace *closest)
+{
+	float	t;
+	int		i;
+
+	closest->t = INFINITY;
+	closest->hit_id = -1;
+	closest->ray = ray;
+	closest->color = 0x000000;
+	ctx->stats->rays++;
+	i = 0;
+	while (i < ctx->map->pl.count)
+	{
+		ctx->stats->tests++;
+		if (plane_primary(ray, &ctx->map->pl, i, &t) && t < closest->t)
+			record_hit(closest, (i << OBJ_TYPE_BITS) | PLANE, t);
+		i++;
+	}
+}
+
+// planes first, then the bounded objects through the bvh or the bin of
+// the tile, the hit point, normal and color are only filled in for the
+// closest hit
+t_trace	*closest_obj(t_ctx *ctx, t_ray ray, t_trace *closest)
+{
+	closest_planes(ctx, ray, closest);
+	if (ctx->bin)
+		leaf_closest(ctx, closest, ctx->bin, ctx->bin_count);
+	else
+		bvh_closest(ctx, ray, closest);
+	if (closest->hit_id < 0)
+		return (NULL);
+	resolve_hit(ctx->map, closest);
+	return (closest);
+}
+
+// the box is checked first like the bvh would, so the cached occluder
+// never blocks a ray the traversal would have let through
+static int	occluder_hit(t_ctx *ctx, t_ray *ray, float max_dist)
+{
+	t_aabb		box;
+	t_float_3	inv;
+	float		t;
+
+	if (ctx->occluder < 0)
+		return (0);
+	if ((ctx->occluder & OBJ_TYPE_MASK) != PLANE)
+	{
+		box = obj_bounds(ctx->map, ctx->occluder);
+		inv.x = 1.0f / ray->dir.x;
+		inv.y = 1.0f / ray->dir.y;
+		inv.z = 1.0f / ray->dir.z;
+		if (ray_box(ray, inv, &box, max_dist) == INFINITY)
+			return (0);
+	}
+	ctx->stats->shadow_tests++;
+	if (!intersect(ctx->map, *ray, ctx->occluder, &t) || t >= max_dist)
+		return (0);
+	ctx->stats->occluder_hits++;
+	return (1);
+}
+
+// whether anything lies between the shadow ray origin and max_dist,
+// the object that blocked the previous shadow ray of this worker is
+// tried first since neighbouring pixels are mostly shadowed by the same
+int	obscured(t_ctx *ctx, t_ray *ray, float max_dist)
+{
+	float	t;
+	int		i;
+
+	ctx->stats->shadow_rays++;
+	if (occluder_hit(ctx, ray, max_dist))
+		return (1);
+	i = 0;
+	while (i < ctx->map->pl.count)
+	{
+		ctx->stats->shadow_tests++;
+		if (plane_intersect(*ray, &ctx->map->pl, i, &t) && t < max_dist)
+		{
+			ctx->occluder = (i << OBJ_TYPE_BITS) | PLANE;
+			return (1);
+		}
+		i++;
+	}
+	return (bvh_occluded(ctx, ray, max_dist));
+}
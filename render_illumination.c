@@ -6,28 +6,30 @@
 /*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/08/06 14:13:34 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/14 15:18:38 by fvonsovs         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:24:41 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
-void	illuminate(t_map *map, t_trace *closest)
+// shading is summed in linear rgb and quantized to srgb once at the end
+void	illuminate(t_ctx *ctx, t_trace *closest)
 {
-	int	color;
+	t_v4	base;
+	t_v4	color;
 
-	color = color_multiply(closest->color, map->amb.lum);
-	if (!calculate_shadow(map, closest))
-		color = add_colors(color, diffuse(map, closest, map->light.lum));
-	closest->color = color;
+	base = color_decode(ctx->win, closest->color);
+	color = base * ctx->map->amb.lum;
+	if (!calculate_shadow(ctx, closest))
+		color += base * diffuse(ctx->map, closest, ctx->map->light.lum);
+	closest->color = color_encode(ctx->win, color);
 }
 
-int	diffuse(t_map *map, t_trace *closest, float intensity)
+// share of the light reaching the hit point
+float	diffuse(t_map *map, t_trace *closest, float intensity)
 {
 	t_float_3	light_dir;
-	int			ret;
 	float		cos_angle;
-	float		ratio;
 	float		attenuation;
 
 	light_dir = vec_sub(map->light.pos, closest->hit_point);
@@ -37,38 +39,35 @@ int	diffuse(t_map *map, t_trace *closest, float intensity)
 	cos_angle = vec_cos(closest->normal, light_dir);
 	if (cos_angle < 0.0f)
 		cos_angle = 0.0f;
-	ratio = intensity * cos_angle * attenuation;
-	ret = color_multiply(closest->color, ratio);
-	return (ret);
+	return (intensity * cos_angle * attenuation);
 }
 
-int	calculate_shadow(t_map *map, t_trace *closest)
+// how far off the surface the shadow ray starts. the hit point is a few
+// float steps of its largest coordinate and of the way the ray came off
+// the surface, so the offset grows with both, see SHADOW_BIAS
+static float	shadow_bias(t_trace *closest)
+{
+	t_float_3	p;
+	float		size;
+
+	p = closest->hit_point;
+	size = f_max(fabsf(p.x), f_max(fabsf(p.y), fabsf(p.z)));
+	size += closest->t * vec_length(closest->ray.dir);
+	return (SHADOW_BIAS * (1.0f + size));
+}
+
+// the shadow ray starts along the unit normal, the sphere normals are
+// as long as the radius
+int	calculate_shadow(t_ctx *ctx, t_trace *closest)
 {
 	t_float_3	light_dir;
 	t_ray		ray;
 	float		dist;
 
-	light_dir = vec_sub(map->light.pos, closest->hit_point);
+	light_dir = vec_sub(ctx->map->light.pos, closest->hit_point);
 	dist = vec_length(light_dir);
-	ray.orig = vec_add(closest->hit_point, vec_mul(closest->normal, 1e-4));
+	ray.orig = vec_add(closest->hit_point,
+			vec_mul(vec_normalize(closest->normal), shadow_bias(closest)));
 	ray.dir = vec_normalize(light_dir);
-	return (obscured(map, &ray, closest->hit_object.object, dist));
-}
-
-int	obscured(t_map *map, t_ray *ray, t_obj *closest, float max_dist)
-{
-	t_obj	*objects;
-	float	t;
-
-	t = INFINITY;
-	objects = map->objects;
-	while (objects != NULL)
-	{
-		if (objects->id == closest->id)
-			objects = objects->next;
-		if (intersect(*ray, objects, &t) && t < max_dist)
-			return (1);
-		objects = objects->next;
-	}
-	return (0);
+	return (obscured(ctx, &ray, dist));
 }
@@ -6,91 +6,87 @@
 /*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/08/31 16:17:51 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/14 15:10:12 by fvonsovs         ###   ########.fr       */
+/*   Updated: 2026/10/18 15:01:12 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
-// calculate vars as described in the struct definition
-// checks for intersection with the cylinders side
+// calculate vars as described in the struct definition, the unit axis,
+// squared radius and cap centers come prepared with the cylinder
+// checks for intersection with the cylinders side, the roots across the
+// axis come from quad_roots() like for the spheres
 // if no intersection with the cylindrical side, check the caps
-int	cylinder_intersect(t_ray ray, t_cy *cylinder, float *t)
+int	cylinder_intersect(t_ray ray, t_cylinders *cy, int i, float *t)
 {
 	t_cyl_intersect	vars;
 
 	vars.hit_side = 0;
 	vars.hit_cap = 0;
-	vars.dia = cylinder->dia;
-	vars.oc = vec_sub(ray.orig, cylinder->pos);
-	vars.cyl_vec = vec_normalize(cylinder->vec);
+	vars.rad2 = cy->rad2[i];
+	vars.hth = cy->hth[i];
+	vars.pos = (t_float_3){cy->x[i], cy->y[i], cy->z[i]};
+	vars.top = (t_float_3){cy->tx[i], cy->ty[i], cy->tz[i]};
+	vars.cyl_vec = (t_float_3){cy->ax[i], cy->ay[i], cy->az[i]};
+	vars.oc = vec_sub(ray.orig, vars.pos);
 	vars.d_cross_a = vec_cross(ray.dir, vars.cyl_vec);
 	vars.oc_cross_a = vec_cross(vars.oc, vars.cyl_vec);
-	vars.a = vec_dot(vars.d_cross_a, vars.d_cross_a);
-	vars.b = 2.0f * vec_dot(vars.d_cross_a, vars.oc_cross_a);
-	vars.c = vec_dot(vars.oc_cross_a, vars.oc_cross_a) \
-	- (cylinder->dia / 2) * (cylinder->dia / 2);
-	vars.disc = vars.b * vars.b - 4 * vars.a * vars.c;
-	vars.hit_side = hit_cyl_side(ray, cylinder, &vars, t);
-	vars.hit_cap = hit_cyl_cap(ray, cylinder, &vars, t);
+	vars.hit_side = quad_roots(&vars, vars.oc_cross_a, vars.d_cross_a,
+			cy->rad2[i]) && hit_cyl_side(ray, &vars, t);
+	vars.hit_cap = hit_cyl_cap(ray, &vars, t);
 	if (vars.hit_side || vars.hit_cap)
 		return (1);
 	else
 		return (0);
 }
 
-int	hit_cyl_side(t_ray ray, t_cy *cylinder, t_cyl_intersect *vars, float *t)
+// the nearer root of quad_roots() if it is in front and between the caps
+int	hit_cyl_side(t_ray ray, t_cyl_intersect *vars, float *t)
 {
-	if (vars->disc >= 0)
+	if (vars->t0 > vars->t1)
+		vars->t0 = vars->t1;
+	if (vars->t0 >= 1e-6f)
 	{
-		vars->t0 = (-vars->b - sqrt(vars->disc)) / (2.0f * vars->a);
-		vars->t1 = (-vars->b + sqrt(vars->disc)) / (2.0f * vars->a);
-		if (vars->t0 > vars->t1)
-			vars->t0 = vars->t1;
-		if (vars->t0 >= 1e-6)
+		vars->hit_point = vec_add(ray.orig, vec_mul(ray.dir, vars->t0));
+		vars->hit_base = vec_sub(vars->hit_point, vars->pos);
+		vars->proj_l = vec_dot(vars->hit_base, vars->cyl_vec);
+		if (vars->proj_l >= 0 && vars->proj_l <= vars->hth)
 		{
-			vars->hit_point = vec_add(ray.orig, vec_mul(ray.dir, vars->t0));
-			vars->hit_base = vec_sub(vars->hit_point, cylinder->pos);
-			vars->proj_l = vec_dot(vars->hit_base, vars->cyl_vec);
-			if (vars->proj_l >= 0 && vars->proj_l <= cylinder->hth)
-			{
-				*t = vars->t0;
-				return (1);
-			}
+			*t = vars->t0;
+			return (1);
 		}
 	}
 	return (0);
 }
 
-int	hit_cyl_cap(t_ray ray, t_cy *cylinder, t_cyl_intersect *vars, float *t)
+// the nearer of the two caps hit, taken over the side only when it is
+// nearer than the side by more than the epsilon
+int	hit_cyl_cap(t_ray ray, t_cyl_intersect *vars, float *t)
 {
-	t_float_3	top_center;
 	float		t_cap;
+	float		limit;
 
-	top_center = vec_add(cylinder->pos, vec_mul(vars->cyl_vec, cylinder->hth));
-	if (intersect_disk(ray, top_center, vars, &t_cap))
+	limit = INFINITY;
+	if (vars->hit_side)
+		limit = *t - 1e-6f;
+	if (intersect_disk(ray, vars->top, vars, &t_cap) && t_cap < limit)
 	{
-		if (!vars->hit_side || t_cap < *t - 1e-6)
-		{
-			*t = t_cap;
-			return (1);
-		}
+		*t = t_cap;
+		limit = t_cap;
+		vars->hit_cap = 1;
 	}
-	if (intersect_disk(ray, cylinder->pos, vars, &t_cap))
+	if (intersect_disk(ray, vars->pos, vars, &t_cap) && t_cap < limit)
 	{
-		if (!vars->hit_side || t_cap < *t - 1e-6)
-		{
-			*t = t_cap;
-			return (1);
-		}
+		*t = t_cap;
+		vars->hit_cap = 1;
 	}
-	return (0);
+	return (vars->hit_cap);
 }
 
 // calculate denominator for intersection with the plane of the disk
 // calculate the intersection point with the plane
 // if the intersection is in the point of the ray, calculate the point
-// check if we are within the diameter of the disk
+// check if we are within the radius of the disk, squared on both sides
 int	intersect_disk(t_ray ray, t_float_3 disk_center, \
 t_cyl_intersect *vars, float *t)
 {
@@ -100,15 +96,15 @@ t_cyl_intersect *vars, float *t)
 	float		t_temp;
 
 	denom = vec_dot(ray.dir, vars->cyl_vec);
-	if (fabs(denom) > 1e-4)
+	if (fabsf(denom) > 1e-4f)
 	{
 		vec = vec_sub(disk_center, ray.orig);
 		t_temp = vec_dot(vec, vars->cyl_vec) / denom;
-		if (t_temp >= 1e-6)
+		if (t_temp >= 1e-6f)
 		{
 			hit_point = vec_add(ray.orig, vec_mul(ray.dir, t_temp));
-			if (vec_length(vec_sub(hit_point, disk_center)) \
-			<= (vars->dia / 2.0f))
+			vec = vec_sub(hit_point, disk_center);
+			if (vec_dot(vec, vec) <= vars->rad2)
 			{
 				*t = t_temp;
 				return (1);
@@ -6,50 +6,66 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/08/06 14:14:27 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/12 21:31:01 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:38:09 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
-int	intersect(t_ray ray, t_obj *obj, float *t)
+// the object with the given id, see t_spheres
+int	intersect(t_map *map, t_ray ray, int id, float *t)
 {
-	if (obj->type == SPHERE)
-		return (sphere_intersect(ray, obj->object, t));
-	if (obj->type == PLANE)
-		return (plane_intersect(ray, obj->object, t));
-	if (obj->type == CYLINDER)
-		return (cylinder_intersect(ray, obj->object, t));
+	if ((id & OBJ_TYPE_MASK) == SPHERE)
+		return (sphere_intersect(ray, &map->sp, id >> OBJ_TYPE_BITS, t));
+	if ((id & OBJ_TYPE_MASK) == PLANE)
+		return (plane_intersect(ray, &map->pl, id >> OBJ_TYPE_BITS, t));
+	if ((id & OBJ_TYPE_MASK) == CYLINDER)
+		return (cylinder_intersect(ray, &map->cy, id >> OBJ_TYPE_BITS, t));
 	else
 		return (0);
 }
 
 // calculate vector from ray origin to sphere center
-// calculate quadratic equation coeffivarsents
-// calculates vars.disc to see if intersects
-// calculates two possible solutions intersection points
-// finds the correct intersection point (smallest distance *t)
-int	sphere_intersect(t_ray ray, t_sp *sphere, float *t)
+// the roots come from quad_roots(), the kernels round the same way
+int	sphere_intersect(t_ray ray, t_spheres *sp, int i, float *t)
 {
 	t_cyl_intersect	vars;
-	float			radius;
 
-	radius = sphere->dia / 2.0;
-	vars.oc = vec_sub(ray.orig, sphere->pos);
-	vars.a = vec_dot(ray.dir, ray.dir);
-	vars.b = 2.0 * vec_dot(vars.oc, ray.dir);
-	vars.c = vec_dot(vars.oc, vars.oc) - (radius * radius);
-	vars.disc = (vars.b * vars.b) - (4 * vars.a * vars.c);
-	if (vars.disc < 0)
+	vars.oc = vec_sub(ray.orig, sphere_center(sp, i));
+	return (quad_roots(&vars, vars.oc, ray.dir, sp->rad2[i])
+		&& sphere_roots(&vars, t));
+}
+
+// the distances vars->t0 <= vars->t1 at which a ray is r2 squared away
+// from a point, u = ray origin minus the point and v = ray direction, or
+// from a line, u and v = the parts of both across it. b is half the
+// usual one and the distance at the closest approach comes from
+// f = u - v * b / a, b * b - a * c would cancel for far objects.
+// the kernels repeat these steps in this order, keep them in step
+int	quad_roots(t_cyl_intersect *vars, t_float_3 u, t_float_3 v, float r2)
+{
+	t_float_3	f;
+
+	vars->a = vec_dot(v, v);
+	vars->b = vec_dot(u, v);
+	f = vec_sub(u, vec_mul(v, vars->b / vars->a));
+	vars->disc = vars->a * (r2 - vec_dot(f, f));
+	if (!(vars->disc >= 0.0f))
 		return (0);
-	vars.t0 = (-vars.b - sqrt(vars.disc)) / (2.0 * vars.a);
-	vars.t1 = (-vars.b + sqrt(vars.disc)) / (2.0 * vars.a);
-	if (vars.t0 > 1e-6 || vars.t1 > 1e-6)
+	vars->t0 = (-vars->b - sqrtf(vars->disc)) / vars->a;
+	vars->t1 = (-vars->b + sqrtf(vars->disc)) / vars->a;
+	return (1);
+}
+
+// finds the correct intersection point (smallest distance *t in front)
+int	sphere_roots(t_cyl_intersect *vars, float *t)
+{
+	if (vars->t0 > 1e-6f || vars->t1 > 1e-6f)
 	{
-		if (vars.t0 > 1e-6)
-			*t = vars.t0;
+		if (vars->t0 > 1e-6f)
+			*t = vars->t0;
 		else
-			*t = vars.t1;
+			*t = vars->t1;
 		return (1);
 	}
 	return (0);
@@ -57,21 +73,18 @@ int	sphere_intersect(t_ray ray, t_sp *sphere, float *t)
 
 // calculates dot product between ray direction and plane normal
 // if denom is close to 0, it is parallel = no intersection
-// if not, calculate vector from ray origin to a point on the plane
-// calculate numerator of intersection formula
-// calculate intersection distance, if > 0 we hit
-int	plane_intersect(t_ray ray, t_pl *plane, float *t)
+// if not, the distance along the normal from the ray origin to the
+// plane over denom is the intersection distance, if > 0 we hit
+int	plane_intersect(t_ray ray, t_planes *pl, int i, float *t)
 {
-	t_float_3	vec;
+	t_float_3	normal;
 	float		denom;
-	float		num;
 
-	denom = vec_dot(ray.dir, plane->vec);
+	normal = (t_float_3){pl->ux[i], pl->uy[i], pl->uz[i]};
+	denom = vec_dot(ray.dir, normal);
 	if (fabs(denom) > 1e-6)
 	{
-		vec = vec_sub(plane->pos, ray.orig);
-		num = vec_dot(vec, plane->vec);
-		*t = num / denom;
+		*t = (pl->d[i] - vec_dot(ray.orig, normal)) / denom;
 		if (*t >= 1e-6)
 			return (1);
 	}
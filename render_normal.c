@@ -6,55 +6,72 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/09/09 12:40:21 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/12 21:28:48 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:52:36 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
-t_float_3	sphere_normal(t_trace *inter)
+t_float_3	sphere_normal(t_map *map, t_trace *inter)
 {
 	t_float_3	normal;
-	t_sp		*sphere;
 
-	sphere = (t_sp *)inter->hit_object.object;
-	normal = vec_sub(inter->hit_point, sphere->pos);
+	normal = vec_sub(inter->hit_point,
+			sphere_center(&map->sp, inter->hit_id >> OBJ_TYPE_BITS));
 	return (normal);
 }
 
-t_float_3	cylinder_normal(t_trace *inter, t_ray ray)
+t_float_3	cylinder_normal(t_map *map, t_trace *inter)
 {
-	t_cy		*cylinder;
-	t_float_3	hit_point;
 	t_float_3	v;
+	t_float_3	axis;
 	t_float_3	projection;
+	int			i;
 
-	cylinder = (t_cy *)inter->hit_object.object;
-	hit_point = vec_add(ray.orig, vec_mul(ray.dir, inter->t));
-	v = vec_sub(hit_point, cylinder->pos);
-	projection = vec_mul(cylinder->vec,
-			vec_dot(v, vec_normalize(cylinder->vec)));
+	i = inter->hit_id >> OBJ_TYPE_BITS;
+	v = vec_sub(inter->hit_point,
+			(t_float_3){map->cy.x[i], map->cy.y[i], map->cy.z[i]});
+	axis = (t_float_3){map->cy.ax[i], map->cy.ay[i], map->cy.az[i]};
+	projection = vec_mul(axis, vec_dot(v, axis));
 	return (vec_normalize(vec_sub(v, projection)));
 }
 
-t_float_3	plane_normal(t_trace *inter, t_ray ray)
+t_float_3	plane_normal(t_map *map, t_trace *inter, t_ray ray)
 {
 	t_float_3	normal;
-	t_pl		*plane;
+	int			i;
 
-	plane = (t_pl *)inter->hit_object.object;
-	normal = plane->vec;
+	i = inter->hit_id >> OBJ_TYPE_BITS;
+	normal = (t_float_3){map->pl.ux[i], map->pl.uy[i], map->pl.uz[i]};
 	if (vec_dot(ray.dir, normal) > 0)
 		normal = vec_negate(normal);
-	return (vec_normalize(normal));
+	return (normal);
+}
+
+// hit point, normal and color of the closest hit along closest->ray
+void	resolve_hit(t_map *map, t_trace *closest)
+{
+	t_ray	ray;
+	int		i;
+
+	ray = closest->ray;
+	i = closest->hit_id >> OBJ_TYPE_BITS;
+	closest->hit_point = vec_add(ray.orig, vec_mul(ray.dir, closest->t));
+	closest->normal = shape_normal(map, closest, ray);
+	if ((closest->hit_id & OBJ_TYPE_MASK) == SPHERE)
+		closest->color = map->sp.col[i];
+	else if ((closest->hit_id & OBJ_TYPE_MASK) == PLANE)
+		closest->color = map->pl.col[i];
+	else
+		closest->color = map->cy.col[i];
 }
 
-t_float_3	shape_normal(t_trace *inter, t_ray ray)
+t_float_3	shape_normal(t_map *map, t_trace *inter, t_ray ray)
 {
-	if (inter->hit_object.type == PLANE)
-		return (plane_normal(inter, ray));
-	else if (inter->hit_object.type == SPHERE)
-		return (sphere_normal(inter));
+	if ((inter->hit_id & OBJ_TYPE_MASK) == PLANE)
+		return (plane_normal(map, inter, ray));
+	else if ((inter->hit_id & OBJ_TYPE_MASK) == SPHERE)
+		return (sphere_normal(map, inter));
 	else
-		return (cylinder_normal(inter, ray));
+		return (cylinder_normal(map, inter));
 }
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_packet.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:41:40 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:20:05 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+static void	set_lane(t_v4 *vec, int lane, float value)
+{
+	vec[lane / 4][lane % 4] = value;
+}
+
+// camera ray of pixel at.z of the block at at.x, at.y tested against the
+// planes, pixels outside the tile stay inactive lanes
+static void	packet_ray(t_ctx *ctx, t_packet *pk, t_rect *rect, t_int_3 at)
+{
+	t_ray	*ray;
+	int		x;
+	int		y;
+
+	x = at.x + at.z % PACKET_W;
+	y = at.y + at.z / PACKET_W;
+	set_lane(pk->t, at.z, -INFINITY);
+	set_lane(pk->inv[0], at.z, 0.0f);
+	set_lane(pk->inv[1], at.z, 0.0f);
+	set_lane(pk->inv[2], at.z, 0.0f);
+	if (x >= rect->x1 || y >= rect->y1)
+		return ;
+	ray = &pk->ray[at.z];
+	closest_planes(ctx, *ray, &pk->hit[at.z]);
+	set_lane(pk->t, at.z, pk->hit[at.z].t);
+	set_lane(pk->inv[0], at.z, inv_dir(ray->dir.x));
+	set_lane(pk->inv[1], at.z, inv_dir(ray->dir.y));
+	set_lane(pk->inv[2], at.z, inv_dir(ray->dir.z));
+	pk->active |= 1 << at.z;
+}
+
+// the rays of the block at at.x, at.y, generated a row of the block at
+// a time
+static void	packet_block(t_ctx *ctx, t_packet *pk, t_rect *rect, t_int_3 at)
+{
+	pk->orig = ctx->map->cam.pos;
+	pk->active = 0;
+	at.z = -1;
+	while (++at.z < PACKET_W)
+		camera_row(ctx->map, (t_int_3){at.x, at.y + at.z, 1}, PACKET_W,
+			pk->ray + at.z * PACKET_W);
+	at.z = -1;
+	while (++at.z < PACKET_RAYS)
+		packet_ray(ctx, pk, rect, at);
+}
+
+static void	packet_shade(t_ctx *ctx, t_packet *pk, t_rect *rect, t_int_3 at)
+{
+	t_trace	*hit;
+	int		lane;
+
+	lane = -1;
+	while (++lane < PACKET_RAYS)
+	{
+		if (!(pk->active & (1 << lane)))
+			continue ;
+		hit = &pk->hit[lane];
+		if (hit->hit_id >= 0)
+		{
+			resolve_hit(ctx->map, hit);
+			illuminate(ctx, hit);
+		}
+		fill_block(ctx, rect, (t_int_3){at.x + lane % PACKET_W,
+			at.y + lane / PACKET_W, 1}, hit->color);
+	}
+}
+
+// full resolution pass over a tile in PACKET_W x PACKET_W blocks, the
+// camera rays of a block share their origin and mostly their path
+// through the bvh, only the shading is done ray by ray
+void	render_packets(t_ctx *ctx, int tile)
+{
+	t_packet	pk;
+	t_rect		rect;
+	t_int_3		at;
+
+	tile_rect(&ctx->win->sched, tile, &rect);
+	at.y = rect.y0;
+	while (at.y < rect.y1)
+	{
+		at.x = rect.x0;
+		while (at.x < rect.x1)
+		{
+			packet_block(ctx, &pk, &rect, at);
+			pk.mask = pk.active;
+			if (ctx->bin)
+				leaf_packet(ctx, &pk, ctx->bin, ctx->bin_count);
+			else
+				packet_closest(ctx, &pk);
+			packet_shade(ctx, &pk, &rect, at);
+			at.x += PACKET_W;
+		}
+		at.y += PACKET_W;
+	}
+	tile_flush(ctx, &rect);
+}
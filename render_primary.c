@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_primary.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:44:58 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 15:44:58 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+static void	view_spheres(t_spheres *sp, t_float_3 cam)
+{
+	int	i;
+
+	i = -1;
+	while (++i < sp->count)
+	{
+		sp->ox[i] = cam.x - sp->x[i];
+		sp->oy[i] = cam.y - sp->y[i];
+		sp->oz[i] = cam.z - sp->z[i];
+	}
+}
+
+// the parts of the sphere and plane tests that only depend on where the
+// camera rays start, once for the pass instead of once per pixel
+void	scene_view(t_map *map)
+{
+	int	i;
+
+	view_spheres(&map->sp, map->cam.pos);
+	i = -1;
+	while (++i < map->pl.count)
+		map->pl.od[i] = map->pl.d[i] - vec_dot(map->cam.pos,
+				(t_float_3){map->pl.ux[i], map->pl.uy[i], map->pl.uz[i]});
+}
+
+// sphere_intersect() for a ray from the camera
+int	sphere_primary(t_ray ray, t_spheres *sp, int i, float *t)
+{
+	t_cyl_intersect	vars;
+
+	vars.oc = (t_float_3){sp->ox[i], sp->oy[i], sp->oz[i]};
+	return (quad_roots(&vars, vars.oc, ray.dir, sp->rad2[i])
+		&& sphere_roots(&vars, t));
+}
+
+// plane_intersect() for a ray from the camera
+int	plane_primary(t_ray ray, t_planes *pl, int i, float *t)
+{
+	float	denom;
+
+	denom = vec_dot(ray.dir, (t_float_3){pl->ux[i], pl->uy[i], pl->uz[i]});
+	if (fabs(denom) > 1e-6)
+	{
+		*t = pl->od[i] / denom;
+		if (*t >= 1e-6)
+			return (1);
+	}
+	return (0);
+}
+
+// intersect() for a ray from the camera, after scene_view()
+int	intersect_primary(t_map *map, t_ray ray, int id, float *t)
+{
+	if ((id & OBJ_TYPE_MASK) == SPHERE)
+		return (sphere_primary(ray, &map->sp, id >> OBJ_TYPE_BITS, t));
+	if ((id & OBJ_TYPE_MASK) == PLANE)
+		return (plane_primary(ray, &map->pl, id >> OBJ_TYPE_BITS, t));
+	return (cylinder_intersect(ray, &map->cy, id >> OBJ_TYPE_BITS, t));
+}
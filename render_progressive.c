@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_progressive.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:51:44 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:59:30 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// pixel rectangle covered by a tile, clipped to the window
+void	tile_rect(t_sched *sched, int tile, t_rect *rect)
+{
+	rect->x0 = (tile % sched->tiles_x) * sched->tile_size;
+	rect->y0 = (tile / sched->tiles_x) * sched->tile_size;
+	rect->x1 = rect->x0 + sched->tile_size;
+	rect->y1 = rect->y0 + sched->tile_size;
+	if (rect->x1 > WINDOW_WIDTH)
+		rect->x1 = WINDOW_WIDTH;
+	if (rect->y1 > WINDOW_HEIGHT)
+		rect->y1 = WINDOW_HEIGHT;
+}
+
+// upscales one preview sample into the tile buffer of ctx, at.x at.y =
+// top left pixel, at.z = size, the block is clipped to the tile
+void	fill_block(t_ctx *ctx, t_rect *rect, t_int_3 at, int color)
+{
+	int	*row;
+	int	x;
+	int	y;
+
+	y = at.y;
+	while (y < at.y + at.z && y < rect->y1)
+	{
+		row = ctx->tile + (y - rect->y0) * ctx->win->sched.tile_size
+			- rect->x0;
+		x = at.x;
+		while (x < at.x + at.z && x < rect->x1)
+			row[x++] = color;
+		y++;
+	}
+}
+
+// block size of the first pass after an edit, 1 without progressive mode
+int	preview_start(t_win *win)
+{
+	if (!win->opts.progressive)
+		return (1);
+	if (win->preview_step < PREVIEW_STEP)
+		win->preview_step = PREVIEW_STEP;
+	return (win->preview_step);
+}
+
+// keeps the first preview inside the latency budget whatever the scene
+// costs, coarser blocks when it was too slow, finer again when cheap
+void	adapt_preview(t_win *win, double ms)
+{
+	if (ms > PREVIEW_BUDGET_MS && win->preview_step < MAX_PREVIEW_STEP)
+		win->preview_step *= 2;
+	else if (ms < PREVIEW_BUDGET_MS / 8.0 && win->preview_step > PREVIEW_STEP)
+		win->preview_step /= 2;
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_setup.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:16:10 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:58:40 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// context of worker id, with the buffers its tiles are put together in
+static void	ctx_init(t_win *win, int id)
+{
+	t_ctx	*ctx;
+
+	ctx = &win->ctx[id];
+	ctx->win = win;
+	ctx->map = win->map;
+	ctx->stats = &win->sched.stats[id];
+	ctx->id = id;
+	ctx->occluder = -1;
+	ctx->tile = malloc(sizeof(int) * win->opts.tile_size
+			* win->opts.tile_size);
+	ctx->rays = malloc(sizeof(t_ray) * win->opts.tile_size);
+	if (!ctx->tile || !ctx->rays)
+		error_throw("Cannot allocate tile buffers");
+}
+
+// starts the render workers and the tile scheduler feeding them
+void	render_setup(t_win *win)
+{
+	int	count;
+
+	count = win->opts.threads;
+	if (count <= 0)
+		count = default_threads(win->num_cores);
+	pool_init(&win->pool, count);
+	if (win->opts.pin)
+		pool_pin(&win->pool);
+	sched_init(&win->sched, count, win->opts.tile_size);
+	win->ctx = ft_calloc(count, sizeof(t_ctx));
+	if (!win->ctx)
+		error_throw("Cannot allocate render contexts");
+	while (count-- > 0)
+		ctx_init(win, count);
+	ft_printf("Rendering with %d threads, %d cores online\n", \
+	win->pool.count, win->num_cores);
+}
+
+// stops the workers and prints what they were doing during the session
+void	render_shutdown(t_win *win)
+{
+	int	i;
+
+	render_cancel(win);
+	pool_destroy(&win->pool);
+	print_render_stats(win);
+	sched_destroy(&win->sched);
+	i = 0;
+	while (i < win->pool.count)
+	{
+		free(win->ctx[i].tile);
+		free(win->ctx[i++].rays);
+	}
+	free(win->ctx);
+	win->ctx = NULL;
+	free(win->bins.start);
+	free(win->bins.ids);
+	free(win->bins.rect);
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_stats.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:14:33 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:58:40 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// counters of all the workers added up
+static void	sum_stats(t_sched *sched, t_tstats *sum)
+{
+	t_tstats	*st;
+	int			i;
+
+	ft_bzero(sum, sizeof(t_tstats));
+	i = 0;
+	while (i < sched->count)
+	{
+		st = &sched->stats[i++];
+		sum->rays += st->rays;
+		sum->nodes += st->nodes;
+		sum->tests += st->tests;
+		sum->shadow_rays += st->shadow_rays;
+		sum->shadow_nodes += st->shadow_nodes;
+		sum->shadow_tests += st->shadow_tests;
+		sum->occluder_hits += st->occluder_hits;
+		sum->packets += st->packets;
+		sum->packet_nodes += st->packet_nodes;
+		sum->fallbacks += st->fallbacks;
+	}
+}
+
+// traversal cost per traced ray, camera and shadow rays apart, and the
+// shadow tests per pixel, one camera ray is traced per pixel
+static void	print_ray_stats(t_sched *sched)
+{
+	t_tstats	sum;
+	double		rays;
+	double		shadow;
+
+	sum_stats(sched, &sum);
+	rays = sum.rays + (sum.rays == 0);
+	shadow = sum.shadow_rays + (sum.shadow_rays == 0);
+	printf("rays %ld, %.2f bvh nodes / ray, %.2f object tests / ray\n",
+		sum.rays, sum.nodes / rays, sum.tests / rays);
+	printf("shadow rays %ld, %.2f bvh nodes / ray, %.2f object tests / ray, "
+		"%.2f tests / pixel, %.1f%% blocked by the last occluder\n",
+		sum.shadow_rays, sum.shadow_nodes / shadow, sum.shadow_tests / shadow,
+		sum.shadow_tests / rays, 100.0 * sum.occluder_hits / shadow);
+	if (sum.packets > 0)
+		printf("packets %ld, %.2f bvh nodes / packet, %ld traced ray by ray\n",
+			sum.packets, (double)sum.packet_nodes / sum.packets, sum.fallbacks);
+}
+
+// per worker report of the time spent tracing tiles vs waiting,
+// idle = wall time of all frames minus the busy time of the worker
+void	print_render_stats(t_win *win)
+{
+	t_sched		*sched;
+	t_tstats	*st;
+	int			i;
+
+	sched = &win->sched;
+	printf("\nframes %d rendered, %ld skipped, avg %.2f ms, tile %dx%d\n",
+		sched->frames, win->skipped,
+		sched->wall * 1000.0 / (sched->frames + (sched->frames == 0)),
+		sched->tile_size, sched->tile_size);
+	i = 0;
+	while (i < sched->count)
+	{
+		st = &sched->stats[i];
+		printf("  thread %2d: busy %8.1f ms idle %8.1f ms (%5.1f%%) "
+			"tiles %7d stolen %6d\n", i, st->busy * 1000.0,
+			(sched->wall - st->busy) * 1000.0,
+			100.0 * st->busy / (sched->wall + (sched->wall == 0.0)),
+			st->tiles, st->stolen);
+		i++;
+	}
+	print_ray_stats(sched);
+	bvh_print(win->map);
+}
@@ -6,37 +6,38 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/09/12 19:52:54 by khlavaty          #+#    #+#             */
-/*   Updated: 2024/09/12 19:53:14 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:46:20 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
+static void	scale(float *size, int count, float scale_factor)
+{
+	int	i;
+
+	i = 0;
+	while (i < count)
+		size[i++] *= scale_factor;
+}
+
+void	resize_object(t_map *map, float scale_factor)
+{
+	scale(map->sp.rad, map->sp.count, scale_factor);
+	scale(map->cy.rad, map->cy.count, scale_factor);
+	scale(map->cy.hth, map->cy.count, scale_factor);
+}
+
 void	resize_objects(t_win *win, int keysym)
 {
-	t_obj	*obj;
 	float	scale_factor;
-	t_sp	*sphere;
-	t_cy	*cylinder;
 
-	obj = win->map->objects;
 	if (keysym == KEY_NUMPAD_PLUS)
 		scale_factor = 1.1;
 	else
 		scale_factor = 0.9;
-	while (obj)
-	{
-		if (obj->type == SPHERE)
-		{
-			sphere = (t_sp *)obj->object;
-			sphere->dia *= scale_factor;
-		}
-		else if (obj->type == CYLINDER)
-		{
-			cylinder = (t_cy *)obj->object;
-			cylinder->dia *= scale_factor;
-			cylinder->hth *= scale_factor;
-		}
-		obj = obj->next;
-	}
+	resize_object(win->map, scale_factor);
+	scene_prepare(win->map, (1 << SPHERE) | (1 << CYLINDER));
+	win->map->version++;
+	win->map->shape_dirty |= (1 << SPHERE) | (1 << CYLINDER);
 }
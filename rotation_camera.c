@@ -6,7 +6,7 @@
 /*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/09/12 19:16:20 by khlavaty          #+#    #+#             */
-/*   Updated: 2024/09/14 15:10:30 by fvonsovs         ###   ########.fr       */
+/*   Updated: 2026/10/18 15:36:40 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,6 +24,7 @@ void	perform_camera_rotation(t_win *win, t_quat q)
 	vec_up = vec_normalize(vec_cross(vec_right, win->map->cam.vec));
 	win->map->vec_right = vec_right;
 	win->map->vec_up = vec_up;
+	camera_prepare(win->map);
 }
 
 void	rotate_camera(t_win *win, int keysym, float angle)
@@ -34,4 +35,5 @@ void	rotate_camera(t_win *win, int keysym, float angle)
 	axis = get_rot_axis_camera(keysym);
 	q = quaternion_from_axis_angle(axis, angle);
 	perform_camera_rotation(win, q);
+	win->map->version++;
 }
@@ -6,7 +6,7 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/09/12 18:44:28 by khlavaty          #+#    #+#             */
-/*   Updated: 2024/09/12 19:09:52 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:47:57 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -38,20 +38,27 @@ void	perform_plane_rotation(t_pl *plane, t_quat q)
 	plane->vec = rotated_vec;
 }
 
-void	rotate_object(t_obj *obj, t_quat q)
+// rotates the cylinder or plane with the given id in place
+void	rotate_object(t_map *map, int id, t_quat q)
 {
-	t_cy	*cylinder;
-	t_pl	*plane;
+	t_cy		cylinder;
+	t_pl		plane;
+	int			i;
 
-	if (obj->type == CYLINDER)
+	i = id >> OBJ_TYPE_BITS;
+	if ((id & OBJ_TYPE_MASK) == CYLINDER)
 	{
-		cylinder = (t_cy *)obj->object;
-		perform_cylinder_rotation(cylinder, q);
+		cylinder = cylinder_at(&map->cy, i);
+		perform_cylinder_rotation(&cylinder, q);
+		cylinder_store(&map->cy, i, &cylinder);
 	}
-	else if (obj->type == PLANE)
+	else if ((id & OBJ_TYPE_MASK) == PLANE)
 	{
-		plane = (t_pl *)obj->object;
-		perform_plane_rotation(plane, q);
+		plane.vec = (t_float_3){map->pl.nx[i], map->pl.ny[i], map->pl.nz[i]};
+		perform_plane_rotation(&plane, q);
+		map->pl.nx[i] = plane.vec.x;
+		map->pl.ny[i] = plane.vec.y;
+		map->pl.nz[i] = plane.vec.z;
 	}
 }
 
@@ -59,32 +66,29 @@ void	rotate_cylinder(t_win *win, int keysym, float angle)
 {
 	t_quat		q;
 	t_float_3	axis;
-	t_obj		*obj;
+	int			i;
 
 	axis = get_rot_axis_cylinder(keysym);
 	q = quaternion_from_axis_angle(axis, angle);
-	obj = win->map->objects;
-	while (obj)
-	{
-		if (obj->type == CYLINDER)
-			rotate_object(obj, q);
-		obj = obj->next;
-	}
+	i = 0;
+	while (i < win->map->cy.count)
+		rotate_object(win->map, (i++ << OBJ_TYPE_BITS) | CYLINDER, q);
+	scene_prepare(win->map, 1 << CYLINDER);
+	win->map->version++;
+	win->map->shape_dirty |= 1 << CYLINDER;
 }
 
 void	rotate_plane(t_win *win, int keysym, float angle)
 {
 	t_quat		q;
 	t_float_3	axis;
-	t_obj		*obj;
+	int			i;
 
 	axis = get_rot_axis_plane(keysym);
 	q = quaternion_from_axis_angle(axis, angle);
-	obj = win->map->objects;
-	while (obj)
-	{
-		if (obj->type == PLANE)
-			rotate_object(obj, q);
-		obj = obj->next;
-	}
+	i = 0;
+	while (i < win->map->pl.count)
+		rotate_object(win->map, (i++ << OBJ_TYPE_BITS) | PLANE, q);
+	scene_prepare(win->map, 1 << PLANE);
+	win->map->version++;
 }
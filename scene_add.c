@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_add.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:54:36 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 12:54:36 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// appends a parsed sphere to the scene arrays
+void	scene_add_sphere(t_map *map, t_sp *s)
+{
+	t_spheres	*sp;
+
+	sp = &map->sp;
+	if (sp->count == sp->cap)
+		grow_spheres(sp);
+	sp->x[sp->count] = s->pos.x;
+	sp->y[sp->count] = s->pos.y;
+	sp->z[sp->count] = s->pos.z;
+	sp->rad[sp->count] = s->dia / 2.0f;
+	sp->col[sp->count] = s->col;
+	sp->count++;
+}
+
+void	scene_add_plane(t_map *map, t_pl *p)
+{
+	t_planes	*pl;
+
+	pl = &map->pl;
+	if (pl->count == pl->cap)
+		grow_planes(pl);
+	pl->x[pl->count] = p->pos.x;
+	pl->y[pl->count] = p->pos.y;
+	pl->z[pl->count] = p->pos.z;
+	pl->nx[pl->count] = p->vec.x;
+	pl->ny[pl->count] = p->vec.y;
+	pl->nz[pl->count] = p->vec.z;
+	pl->col[pl->count] = p->col;
+	pl->count++;
+}
+
+void	scene_add_cylinder(t_map *map, t_cy *c)
+{
+	t_cylinders	*cy;
+
+	cy = &map->cy;
+	if (cy->count == cy->cap)
+		grow_cylinders(cy);
+	cy->col[cy->count] = c->col;
+	cylinder_store(cy, cy->count, c);
+	cy->count++;
+}
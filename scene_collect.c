@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_collect.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:22:27 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:00:21 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// lists the ids of the spheres and cylinders the bvh is built over,
+// the planes are tested straight from their arrays
+void	collect_objects(t_map *map)
+{
+	int	i;
+
+	free(map->bounded);
+	map->bounded = malloc(sizeof(int) * (map->sp.count + map->cy.count + 1));
+	if (!map->bounded)
+		error_throw("Cannot allocate scene arrays");
+	map->num_bounded = 0;
+	i = -1;
+	while (++i < map->sp.count)
+		map->bounded[map->num_bounded++] = (i << OBJ_TYPE_BITS) | SPHERE;
+	i = -1;
+	while (++i < map->cy.count)
+		map->bounded[map->num_bounded++] = (i << OBJ_TYPE_BITS) | CYLINDER;
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_compile.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:57:50 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 13:49:34 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// field[k] = old field[order[k]] for the count first elements
+static void	permute_float(float **field, int *order, int count, int cap)
+{
+	float	*arr;
+	int		k;
+
+	arr = malloc(sizeof(float) * (cap + SCENE_PAD));
+	if (!arr)
+		error_throw("Cannot allocate scene arrays");
+	k = -1;
+	while (++k < count)
+		arr[k] = (*field)[order[k]];
+	free(*field);
+	*field = arr;
+}
+
+static void	permute_int(int **field, int *order, int count, int cap)
+{
+	int		*arr;
+	int		k;
+
+	arr = malloc(sizeof(int) * (cap + SCENE_PAD));
+	if (!arr)
+		error_throw("Cannot allocate scene arrays");
+	k = -1;
+	while (++k < count)
+		arr[k] = (*field)[order[k]];
+	free(*field);
+	*field = arr;
+}
+
+// the order arrays are used up
+static void	permute_spheres(t_spheres *sp, int *order)
+{
+	permute_float(&sp->x, order, sp->count, sp->cap);
+	permute_float(&sp->y, order, sp->count, sp->cap);
+	permute_float(&sp->z, order, sp->count, sp->cap);
+	permute_float(&sp->rad, order, sp->count, sp->cap);
+	permute_int(&sp->col, order, sp->count, sp->cap);
+	free(order);
+}
+
+static void	permute_cylinders(t_cylinders *cy, int *order)
+{
+	permute_float(&cy->x, order, cy->count, cy->cap);
+	permute_float(&cy->y, order, cy->count, cy->cap);
+	permute_float(&cy->z, order, cy->count, cy->cap);
+	permute_float(&cy->vx, order, cy->count, cy->cap);
+	permute_float(&cy->vy, order, cy->count, cy->cap);
+	permute_float(&cy->vz, order, cy->count, cy->cap);
+	permute_float(&cy->rad, order, cy->count, cy->cap);
+	permute_float(&cy->hth, order, cy->count, cy->cap);
+	permute_int(&cy->col, order, cy->count, cy->cap);
+	free(order);
+}
+
+// run once after the first bvh build: the spheres and cylinders are
+// renumbered in the order the bvh leaves list them, so the objects of a
+// leaf sit next to each other in the arrays. ids stay fixed from then on,
+// the derived fields are prepared again in the new order
+void	scene_compile(t_map *map)
+{
+	int		*sp_order;
+	int		*cy_order;
+	t_int_3	n;
+	int		id;
+
+	sp_order = malloc(sizeof(int) * (map->sp.count + 1));
+	cy_order = malloc(sizeof(int) * (map->cy.count + 1));
+	if (!sp_order || !cy_order)
+		error_throw("Cannot allocate scene arrays");
+	n = (t_int_3){-1, 0, 0};
+	while (++n.x < map->num_bounded)
+	{
+		id = map->bounded[n.x];
+		if ((id & OBJ_TYPE_MASK) == SPHERE)
+			sp_order[n.y] = id >> OBJ_TYPE_BITS;
+		else
+			cy_order[n.z] = id >> OBJ_TYPE_BITS;
+		if ((id & OBJ_TYPE_MASK) == SPHERE)
+			map->bounded[n.x] = (n.y++ << OBJ_TYPE_BITS) | SPHERE;
+		else
+			map->bounded[n.x] = (n.z++ << OBJ_TYPE_BITS) | CYLINDER;
+	}
+	permute_spheres(&map->sp, sp_order);
+	permute_cylinders(&map->cy, cy_order);
+	scene_prepare(map, (1 << SPHERE) | (1 << CYLINDER));
+}
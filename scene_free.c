@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_free.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:33:24 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 15:49:21 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+static void	free_spheres(t_spheres *sp)
+{
+	free(sp->x);
+	free(sp->y);
+	free(sp->z);
+	free(sp->rad);
+	free(sp->col);
+	free(sp->rad2);
+	free(sp->box);
+	free(sp->ox);
+	free(sp->oy);
+	free(sp->oz);
+}
+
+static void	free_planes(t_planes *pl)
+{
+	free(pl->x);
+	free(pl->y);
+	free(pl->z);
+	free(pl->nx);
+	free(pl->ny);
+	free(pl->nz);
+	free(pl->col);
+	free(pl->ux);
+	free(pl->uy);
+	free(pl->uz);
+	free(pl->d);
+	free(pl->od);
+}
+
+static void	free_cylinders(t_cylinders *cy)
+{
+	free(cy->x);
+	free(cy->y);
+	free(cy->z);
+	free(cy->vx);
+	free(cy->vy);
+	free(cy->vz);
+	free(cy->rad);
+	free(cy->hth);
+	free(cy->col);
+	free(cy->ax);
+	free(cy->ay);
+	free(cy->az);
+	free(cy->rad2);
+	free(cy->tx);
+	free(cy->ty);
+	free(cy->tz);
+	free(cy->box);
+}
+
+void	scene_free(t_map *map)
+{
+	free_spheres(&map->sp);
+	free_planes(&map->pl);
+	free_cylinders(&map->cy);
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_get.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:56:13 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 12:56:13 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+t_float_3	sphere_center(t_spheres *sp, int i)
+{
+	return ((t_float_3){sp->x[i], sp->y[i], sp->z[i]});
+}
+
+// cylinder i gathered into one struct for the cylinder math
+t_cy	cylinder_at(t_cylinders *cy, int i)
+{
+	t_cy	c;
+
+	c.pos = (t_float_3){cy->x[i], cy->y[i], cy->z[i]};
+	c.vec = (t_float_3){cy->vx[i], cy->vy[i], cy->vz[i]};
+	c.dia = cy->rad[i] * 2.0f;
+	c.hth = cy->hth[i];
+	c.col = cy->col[i];
+	return (c);
+}
+
+// writes the shape of c back as cylinder i, the color is left alone
+void	cylinder_store(t_cylinders *cy, int i, t_cy *c)
+{
+	cy->x[i] = c->pos.x;
+	cy->y[i] = c->pos.y;
+	cy->z[i] = c->pos.z;
+	cy->vx[i] = c->vec.x;
+	cy->vy[i] = c->vec.y;
+	cy->vz[i] = c->vec.z;
+	cy->rad[i] = c->dia / 2.0f;
+	cy->hth[i] = c->hth;
+}
+
+// how many of the count ids from ids name objects of the same type with
+// consecutive indices, which scene_compile() makes the common case
+// inside a leaf, 0 when they are too few to batch, see SPHERE_BATCH_MIN
+int	obj_run(int *ids, int count)
+{
+	int	n;
+
+	n = 1;
+	while (n < count && ids[n] == ids[0] + (n << OBJ_TYPE_BITS))
+		n++;
+	if (n < SPHERE_BATCH_MIN && (ids[0] & OBJ_TYPE_MASK) == SPHERE)
+		return (0);
+	return (n);
+}
+
+// nearest of the count objects named by ids closer than closest->t
+// through the batched kernel of their type, see obj_run()
+int	run_nearest(t_map *map, int *ids, int count, t_trace *closest)
+{
+	if ((ids[0] & OBJ_TYPE_MASK) == SPHERE)
+		return (map->sp.nearest(&map->sp, ids[0] >> OBJ_TYPE_BITS, count,
+				closest));
+	return (cylinders_nearest(&map->cy, ids[0] >> OBJ_TYPE_BITS, count,
+			closest));
+}
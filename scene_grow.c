@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_grow.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:52:59 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 15:49:21 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// moves the first count elements of old into a new array of cap, plus
+// the SCENE_PAD spare ones
+static void	*grow_array(void *old, int count, int cap, size_t size)
+{
+	void	*arr;
+
+	arr = malloc(size * (cap + SCENE_PAD));
+	if (!arr)
+		error_throw("Cannot allocate scene arrays");
+	if (count)
+		ft_memcpy(arr, old, size * count);
+	free(old);
+	return (arr);
+}
+
+// doubles the room of every sphere array
+void	grow_spheres(t_spheres *sp)
+{
+	int	cap;
+
+	cap = sp->cap * 2;
+	if (cap == 0)
+		cap = SCENE_MIN_CAP;
+	sp->x = grow_array(sp->x, sp->count, cap, sizeof(float));
+	sp->y = grow_array(sp->y, sp->count, cap, sizeof(float));
+	sp->z = grow_array(sp->z, sp->count, cap, sizeof(float));
+	sp->rad = grow_array(sp->rad, sp->count, cap, sizeof(float));
+	sp->col = grow_array(sp->col, sp->count, cap, sizeof(int));
+	sp->rad2 = grow_array(sp->rad2, sp->count, cap, sizeof(float));
+	sp->box = grow_array(sp->box, sp->count, cap, sizeof(t_aabb));
+	sp->ox = grow_array(sp->ox, sp->count, cap, sizeof(float));
+	sp->oy = grow_array(sp->oy, sp->count, cap, sizeof(float));
+	sp->oz = grow_array(sp->oz, sp->count, cap, sizeof(float));
+	sp->cap = cap;
+}
+
+void	grow_planes(t_planes *pl)
+{
+	int	cap;
+
+	cap = pl->cap * 2;
+	if (cap == 0)
+		cap = SCENE_MIN_CAP;
+	pl->x = grow_array(pl->x, pl->count, cap, sizeof(float));
+	pl->y = grow_array(pl->y, pl->count, cap, sizeof(float));
+	pl->z = grow_array(pl->z, pl->count, cap, sizeof(float));
+	pl->nx = grow_array(pl->nx, pl->count, cap, sizeof(float));
+	pl->ny = grow_array(pl->ny, pl->count, cap, sizeof(float));
+	pl->nz = grow_array(pl->nz, pl->count, cap, sizeof(float));
+	pl->col = grow_array(pl->col, pl->count, cap, sizeof(int));
+	pl->ux = grow_array(pl->ux, pl->count, cap, sizeof(float));
+	pl->uy = grow_array(pl->uy, pl->count, cap, sizeof(float));
+	pl->uz = grow_array(pl->uz, pl->count, cap, sizeof(float));
+	pl->d = grow_array(pl->d, pl->count, cap, sizeof(float));
+	pl->od = grow_array(pl->od, pl->count, cap, sizeof(float));
+	pl->cap = cap;
+}
+
+void	grow_cylinders(t_cylinders *cy)
+{
+	int	cap;
+
+	cap = cy->cap * 2;
+	if (cap == 0)
+		cap = SCENE_MIN_CAP;
+	cy->x = grow_array(cy->x, cy->count, cap, sizeof(float));
+	cy->y = grow_array(cy->y, cy->count, cap, sizeof(float));
+	cy->z = grow_array(cy->z, cy->count, cap, sizeof(float));
+	cy->vx = grow_array(cy->vx, cy->count, cap, sizeof(float));
+	cy->vy = grow_array(cy->vy, cy->count, cap, sizeof(float));
+	cy->vz = grow_array(cy->vz, cy->count, cap, sizeof(float));
+	cy->rad = grow_array(cy->rad, cy->count, cap, sizeof(float));
+	cy->hth = grow_array(cy->hth, cy->count, cap, sizeof(float));
+	cy->col = grow_array(cy->col, cy->count, cap, sizeof(int));
+	cy->ax = grow_array(cy->ax, cy->count, cap, sizeof(float));
+	cy->ay = grow_array(cy->ay, cy->count, cap, sizeof(float));
+	cy->az = grow_array(cy->az, cy->count, cap, sizeof(float));
+	cy->rad2 = grow_array(cy->rad2, cy->count, cap, sizeof(float));
+	cy->tx = grow_array(cy->tx, cy->count, cap, sizeof(float));
+	cy->ty = grow_array(cy->ty, cy->count, cap, sizeof(float));
+	cy->tz = grow_array(cy->tz, cy->count, cap, sizeof(float));
+	cy->box = grow_array(cy->box, cy->count, cap, sizeof(t_aabb));
+	cy->cap = cap;
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_prepare.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:35:01 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 13:35:01 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+static void	prepare_spheres(t_spheres *sp)
+{
+	float	r;
+	int		i;
+
+	i = -1;
+	while (++i < sp->count)
+	{
+		r = fabsf(sp->rad[i]);
+		sp->rad2[i] = sp->rad[i] * sp->rad[i];
+		sp->box[i].min = (t_float_3){sp->x[i] - r, sp->y[i] - r, sp->z[i] - r};
+		sp->box[i].max = (t_float_3){sp->x[i] + r, sp->y[i] + r, sp->z[i] + r};
+	}
+}
+
+static void	prepare_planes(t_planes *pl)
+{
+	t_float_3	n;
+	int			i;
+
+	i = -1;
+	while (++i < pl->count)
+	{
+		n = vec_normalize((t_float_3){pl->nx[i], pl->ny[i], pl->nz[i]});
+		pl->ux[i] = n.x;
+		pl->uy[i] = n.y;
+		pl->uz[i] = n.z;
+		pl->d[i] = vec_dot(n, (t_float_3){pl->x[i], pl->y[i], pl->z[i]});
+	}
+}
+
+// box around both caps of the cylinder, a cap of radius r around a unit
+// axis a spans r * sqrt(1 - a.x^2) along x, same for y and z
+static t_aabb	cylinder_box(t_float_3 pos, t_float_3 top, t_float_3 axis, \
+float r)
+{
+	t_aabb		box;
+	t_float_3	ext;
+
+	ext.x = r * sqrtf(fmaxf(0.0f, 1.0f - axis.x * axis.x));
+	ext.y = r * sqrtf(fmaxf(0.0f, 1.0f - axis.y * axis.y));
+	ext.z = r * sqrtf(fmaxf(0.0f, 1.0f - axis.z * axis.z));
+	box.min.x = fminf(pos.x, top.x) - ext.x;
+	box.min.y = fminf(pos.y, top.y) - ext.y;
+	box.min.z = fminf(pos.z, top.z) - ext.z;
+	box.max.x = fmaxf(pos.x, top.x) + ext.x;
+	box.max.y = fmaxf(pos.y, top.y) + ext.y;
+	box.max.z = fmaxf(pos.z, top.z) + ext.z;
+	return (box);
+}
+
+static void	prepare_cylinders(t_cylinders *cy)
+{
+	t_float_3	pos;
+	t_float_3	axis;
+	t_float_3	top;
+	int			i;
+
+	i = -1;
+	while (++i < cy->count)
+	{
+		pos = (t_float_3){cy->x[i], cy->y[i], cy->z[i]};
+		axis = vec_normalize((t_float_3){cy->vx[i], cy->vy[i], cy->vz[i]});
+		top = vec_add(pos, vec_mul(axis, cy->hth[i]));
+		cy->ax[i] = axis.x;
+		cy->ay[i] = axis.y;
+		cy->az[i] = axis.z;
+		cy->rad2[i] = cy->rad[i] * cy->rad[i];
+		cy->tx[i] = top.x;
+		cy->ty[i] = top.y;
+		cy->tz[i] = top.z;
+		cy->box[i] = cylinder_box(pos, top, axis, fabsf(cy->rad[i]));
+	}
+}
+
+// recomputes the derived fields of the objects of the given types
+void	scene_prepare(t_map *map, int types)
+{
+	if (types & (1 << SPHERE))
+		prepare_spheres(&map->sp);
+	if (types & (1 << PLANE))
+		prepare_planes(&map->pl);
+	if (types & (1 << CYLINDER))
+		prepare_cylinders(&map->cy);
+}
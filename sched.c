@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sched.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:09:42 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:58:40 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// splits the window into tile_size x tile_size tiles and allocates
+// one deque per worker big enough to hold every tile of the frame
+void	sched_init(t_sched *sched, int count, int tile_size)
+{
+	int	i;
+
+	ft_bzero(sched, sizeof(t_sched));
+	sched->count = count;
+	sched->tile_size = tile_size;
+	sched->tiles_x = (WINDOW_WIDTH + tile_size - 1) / tile_size;
+	sched->tiles_y = (WINDOW_HEIGHT + tile_size - 1) / tile_size;
+	sched->num_tiles = sched->tiles_x * sched->tiles_y;
+	sched->queues = ft_calloc(count, sizeof(t_deque));
+	sched->stats = ft_calloc(count, sizeof(t_tstats));
+	sched->tiles = malloc(sizeof(int) * sched->num_tiles);
+	if (!sched->queues || !sched->stats || !sched->tiles)
+		error_throw("Cannot allocate tile scheduler");
+	i = 0;
+	while (i < count)
+		pthread_mutex_init(&sched->queues[i++].lock, NULL);
+}
+
+void	sched_destroy(t_sched *sched)
+{
+	int	i;
+
+	i = 0;
+	while (sched->queues && i < sched->count)
+		pthread_mutex_destroy(&sched->queues[i++].lock);
+	free(sched->queues);
+	free(sched->stats);
+	free(sched->tiles);
+	sched->queues = NULL;
+	sched->stats = NULL;
+	sched->tiles = NULL;
+}
+
+// hands every worker a contiguous run of tiles for the next frame,
+// workers that run dry steal from the back of the other deques
+void	sched_reset(t_sched *sched)
+{
+	int	i;
+	int	per;
+
+	i = 0;
+	while (i < sched->num_tiles)
+	{
+		sched->tiles[i] = i;
+		i++;
+	}
+	per = sched->num_tiles / sched->count;
+	i = 0;
+	while (i < sched->count)
+	{
+		sched->queues[i].tiles = sched->tiles;
+		sched->queues[i].head = i * per;
+		sched->queues[i].tail = (i + 1) * per;
+		if (i == sched->count - 1)
+			sched->queues[i].tail = sched->num_tiles;
+		i++;
+	}
+}
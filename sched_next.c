@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sched_next.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:11:19 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 17:58:40 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// owner end of the deque, walks its tiles front to back
+static int	deque_pop(t_deque *queue)
+{
+	int	tile;
+
+	tile = -1;
+	pthread_mutex_lock(&queue->lock);
+	if (queue->head < queue->tail)
+		tile = queue->tiles[queue->head++];
+	pthread_mutex_unlock(&queue->lock);
+	return (tile);
+}
+
+// thief end of the deque, takes the tile furthest away from the owner
+static int	deque_steal(t_deque *queue)
+{
+	int	tile;
+
+	tile = -1;
+	pthread_mutex_lock(&queue->lock);
+	if (queue->head < queue->tail)
+		tile = queue->tiles[--queue->tail];
+	pthread_mutex_unlock(&queue->lock);
+	return (tile);
+}
+
+// next tile for worker id, from its own deque first, then stolen from
+// the other workers in round robin order, -1 once the frame is done
+int	sched_next(t_sched *sched, int id)
+{
+	int	tile;
+	int	i;
+
+	tile = deque_pop(&sched->queues[id]);
+	if (tile >= 0)
+		return (tile);
+	i = 1;
+	while (i < sched->count)
+	{
+		tile = deque_steal(&sched->queues[(id + i) % sched->count]);
+		if (tile >= 0)
+		{
+			sched->stats[id].stolen++;
+			return (tile);
+		}
+		i++;
+	}
+	return (-1);
+}
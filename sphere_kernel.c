@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_kernel.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:31:40 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 15:01:12 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+void	sphere_ray(t_sphere_ray *r, t_ray *ray)
+{
+	r->orig = ray->orig;
+	r->dir = ray->dir;
+	r->a = vec_dot(ray->dir, ray->dir);
+}
+
+// the steps of quad_roots() and sphere_roots() for the spheres i to
+// i + 3, the distance of the nearest hit in front of the ray per lane or
+// INFINITY, also for the lanes at or past the lanes first ones
+static t_v4	sphere_t4(t_spheres *sp, int i, int lanes, t_sphere_ray *r)
+{
+	t_v4	o[3];
+	t_v4	b;
+	t_v4	c;
+	t_v4	t0;
+	t_m4	m;
+
+	o[0] = r->orig.x - *(t_v4u *)(sp->x + i);
+	o[1] = r->orig.y - *(t_v4u *)(sp->y + i);
+	o[2] = r->orig.z - *(t_v4u *)(sp->z + i);
+	b = o[0] * r->dir.x + o[1] * r->dir.y + o[2] * r->dir.z;
+	c = b / r->a;
+	o[0] = o[0] - r->dir.x * c;
+	o[1] = o[1] - r->dir.y * c;
+	o[2] = o[2] - r->dir.z * c;
+	c = r->a * (*(t_v4u *)(sp->rad2 + i) - v4_dot(o, o));
+	t0 = v4_sqrt(c);
+	c = (-b + t0) / r->a;
+	t0 = (-b - t0) / r->a;
+	m = t0 > 1e-6f;
+	t0 = (t_v4)(((t_m4)t0 & m) | ((t_m4)c & ~m));
+	m = (t0 > 1e-6f) & ((t_m4){0, 1, 2, 3} < lanes);
+	return ((t_v4)(((t_m4)t0 & m) | ((t_m4)(t_v4){INFINITY, INFINITY,
+			INFINITY, INFINITY} & ~m)));
+}
+
+// records the nearest of the lanes distances in t below closest->t, lane
+// k is the object id + (k << OBJ_TYPE_BITS). the lowest lane wins a tie
+// like in the scalar loops
+void	lanes_pick(float *t, int id, int lanes, t_trace *closest)
+{
+	int	k;
+
+	k = -1;
+	while (++k < lanes)
+	{
+		if (t[k] < closest->t)
+			record_hit(closest, id + (k << OBJ_TYPE_BITS), t[k]);
+	}
+}
+
+// 4 spheres per step, the baseline for every cpu
+int	spheres_nearest4(t_spheres *sp, int first, int count, t_trace *closest)
+{
+	t_sphere_ray	r;
+	t_v4			t;
+	int				hit;
+	int				i;
+
+	sphere_ray(&r, &closest->ray);
+	hit = closest->hit_id;
+	i = 0;
+	while (i < count)
+	{
+		t = sphere_t4(sp, first + i, count - i, &r);
+		lanes_pick((float *)&t, ((first + i) << OBJ_TYPE_BITS) | SPHERE, 4,
+			closest);
+		i += 4;
+	}
+	return (closest->hit_id != hit);
+}
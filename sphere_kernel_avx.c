@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_kernel_avx.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:34:22 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:09 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+# include <immintrin.h>
+
+// sphere_t4() 8 wide, built for avx2 whatever the flags of the rest
+__attribute__((target("avx2")))
+static t_v8	sphere_t8(t_spheres *sp, int i, int lanes, t_sphere_ray *r)
+{
+	t_v8	o[3];
+	t_v8	b;
+	t_v8	c;
+	t_v8	t0;
+	t_m8	m;
+
+	o[0] = r->orig.x - *(t_v8u *)(sp->x + i);
+	o[1] = r->orig.y - *(t_v8u *)(sp->y + i);
+	o[2] = r->orig.z - *(t_v8u *)(sp->z + i);
+	b = o[0] * r->dir.x + o[1] * r->dir.y + o[2] * r->dir.z;
+	c = b / r->a;
+	o[0] = o[0] - r->dir.x * c;
+	o[1] = o[1] - r->dir.y * c;
+	o[2] = o[2] - r->dir.z * c;
+	c = r->a * (*(t_v8u *)(sp->rad2 + i)
+			- (o[0] * o[0] + o[1] * o[1] + o[2] * o[2]));
+	t0 = (t_v8)_mm256_sqrt_ps((__m256)c);
+	c = (-b + t0) / r->a;
+	t0 = (-b - t0) / r->a;
+	m = t0 > 1e-6f;
+	t0 = (t_v8)(((t_m8)t0 & m) | ((t_m8)c & ~m));
+	m = (t0 > 1e-6f) & ((t_m8){0, 1, 2, 3, 4, 5, 6, 7} < lanes);
+	c = (t_v8)_mm256_set1_ps(INFINITY);
+	return ((t_v8)(((t_m8)t0 & m) | ((t_m8)c & ~m)));
+}
+
+// 8 spheres per step, steps whose lanes all miss or lie behind the
+// closest hit skip the scalar pick
+__attribute__((target("avx2")))
+int	spheres_nearest8(t_spheres *sp, int first, int count, t_trace *closest)
+{
+	t_sphere_ray	r;
+	t_v8			t;
+	int				hit;
+	int				i;
+
+	sphere_ray(&r, &closest->ray);
+	hit = closest->hit_id;
+	i = 0;
+	while (i < count)
+	{
+		t = sphere_t8(sp, first + i, count - i, &r);
+		if (_mm256_movemask_ps((__m256)(t < closest->t)))
+			lanes_pick((float *)&t, ((first + i) << OBJ_TYPE_BITS) | SPHERE,
+				8, closest);
+		i += 8;
+	}
+	return (closest->hit_id != hit);
+}
+
+// the avx2 kernel where the cpu runs it, checked once at startup
+t_sphere_kernel	sphere_kernel(void)
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return (spheres_nearest8);
+	return (spheres_nearest4);
+}
+#else
+
+t_sphere_kernel	sphere_kernel(void)
+{
+	return (spheres_nearest4);
+}
+#endif
@@ -0,0 +1,18 @@
+#!/bin/sh
+# renders one random scene of ${1:-2000} objects headless with every
+# acceleration mode and checks the images are the same byte for byte
+set -e
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+./bench/gen_scene "${1:-2000}" > "$dir/rand.rt"
+./miniRT "$dir/rand.rt" --output "$dir/ref.ppm" > /dev/null
+for args in "--accel bins" "--no-packets" "--accel bins --no-packets" \
+	"--bvh median" "--bvh middle"
+do
+	./miniRT "$dir/rand.rt" $args --output "$dir/out.ppm" > /dev/null
+	if ! cmp -s "$dir/ref.ppm" "$dir/out.ppm"; then
+		echo "accel modes differ: $args"
+		exit 1
+	fi
+done
+echo "${1:-2000} objects, every accel mode renders the same image"
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_accel.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:12:37 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 16:16:52 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+#define TEST_OBJECTS 2000
+#define TEST_TILE 32
+
+// xorshift, the same scene on every run
+static float	rnd(unsigned int *seed, float lo, float hi)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return (lo + (hi - lo) * (*seed >> 8) / 16777216.0f);
+}
+
+// spheres and, one in five, cylinders of any direction in an 80 unit
+// cube in front of the camera, over a floor plane
+static t_map	*fill(unsigned int *seed)
+{
+	t_map	*map;
+	t_sp	s;
+	t_cy	c;
+	int		i;
+
+	map = malloc_map();
+	s.col = 0xFFFFFF;
+	i = -1;
+	while (++i < TEST_OBJECTS)
+	{
+		s.pos = (t_float_3){rnd(seed, -40, 40), rnd(seed, -40, 40),
+			rnd(seed, -40, 40)};
+		s.dia = rnd(seed, 0.2f, 1.6f);
+		c = (t_cy){s.pos, (t_float_3){rnd(seed, -1, 1), rnd(seed, -1, 1),
+			rnd(seed, -1, 1)}, s.dia, 2.0f * s.dia, s.col};
+		if (i % 5)
+			scene_add_sphere(map, &s);
+		else
+			scene_add_cylinder(map, &c);
+	}
+	scene_add_plane(map, &(t_pl){{0, -25, 0}, {0, 1, 0}, 0x787878});
+	scene_prepare(map, OBJ_ALL_TYPES);
+	return (map);
+}
+
+// the scene set up like start() does, the tile bins built for it and one
+// render context on the calling thread
+static void	setup(t_win *win, t_ctx *ctx)
+{
+	unsigned int	seed;
+
+	ft_bzero(win, sizeof(t_win));
+	ft_bzero(ctx, sizeof(t_ctx));
+	seed = 2463534242u;
+	win->map = fill(&seed);
+	win->map->cam = (t_cam){{0, 0, -60}, {0, 0, 1}, 70};
+	camera_init(win->map);
+	win->map->bvh_info.split = BVH_SAH;
+	bvh_build(win->map, NULL);
+	scene_compile(win->map);
+	scene_view(win->map);
+	win->opts.accel = ACCEL_BINS;
+	sched_init(&win->sched, 1, TEST_TILE);
+	bins_build(win);
+	ctx->win = win;
+	ctx->map = win->map;
+	ctx->stats = win->sched.stats;
+	ctx->occluder = -1;
+}
+
+// the closest hit of every camera ray of the tile through its bin and
+// through the bvh, the number of pixels where the object or the
+// distance differ
+static int	check_tile(t_ctx *ctx, int tile)
+{
+	t_rect	rect;
+	t_trace	tr[2];
+	int		bad;
+	int		y;
+	int		k;
+
+	tile_rect(&ctx->win->sched, tile, &rect);
+	bad = 0;
+	y = rect.y0 - 1;
+	while (++y < rect.y1)
+	{
+		camera_row(ctx->map, (t_int_3){rect.x0, y, 1}, rect.x1 - rect.x0,
+			ctx->rays);
+		k = -1;
+		while (++k < rect.x1 - rect.x0)
+		{
+			bins_select(ctx, tile);
+			closest_obj(ctx, ctx->rays[k], &tr[0]);
+			ctx->bin = NULL;
+			closest_obj(ctx, ctx->rays[k], &tr[1]);
+			bad += tr[0].hit_id != tr[1].hit_id || tr[0].t != tr[1].t;
+		}
+	}
+	return (bad);
+}
+
+// --accel bins against the bvh on every pixel of a random scene
+int	main(void)
+{
+	t_win	win;
+	t_ctx	ctx;
+	t_ray	rays[TEST_TILE];
+	int		bad;
+	int		tile;
+
+	setup(&win, &ctx);
+	ctx.rays = rays;
+	bad = 0;
+	tile = -1;
+	while (++tile < win.sched.num_tiles)
+		bad += check_tile(&ctx, tile);
+	printf("%d objects, pixels where bins and the bvh differ: %d\n",
+		TEST_OBJECTS, bad);
+	sched_destroy(&win.sched);
+	free(win.bins.start);
+	free(win.bins.ids);
+	free(win.bins.rect);
+	free_map(win.map);
+	return (bad != 0);
+}
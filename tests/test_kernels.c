@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_kernels.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:41:52 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 15:01:12 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+#define TEST_OBJECTS 256
+#define TEST_RAYS 20000
+
+// xorshift, the same fuzzed set on every run
+static float	rnd(unsigned int *seed, float lo, float hi)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return (lo + (hi - lo) * (*seed >> 8) / 16777216.0f);
+}
+
+// spheres and cylinders of every size and direction in a 60 unit cube
+static t_map	*fill(unsigned int *seed)
+{
+	t_map	*map;
+	t_sp	s;
+	t_cy	c;
+	int		i;
+
+	map = malloc_map();
+	s.col = 0xFFFFFF;
+	c.col = 0xFFFFFF;
+	i = -1;
+	while (++i < TEST_OBJECTS)
+	{
+		s.pos = (t_float_3){rnd(seed, -30, 30), rnd(seed, -30, 30),
+			rnd(seed, -30, 30)};
+		s.dia = rnd(seed, 0.01f, 12.0f);
+		scene_add_sphere(map, &s);
+		c.pos = (t_float_3){rnd(seed, -30, 30), rnd(seed, -30, 30),
+			rnd(seed, -30, 30)};
+		c.vec = (t_float_3){rnd(seed, -1, 1), rnd(seed, -1, 1),
+			rnd(seed, -1, 1)};
+		c.dia = rnd(seed, 0.01f, 12.0f);
+		c.hth = rnd(seed, 0.01f, 20.0f);
+		scene_add_cylinder(map, &c);
+	}
+	scene_prepare(map, OBJ_ALL_TYPES);
+	return (map);
+}
+
+// three rays in four are aimed into the box of a random object of the
+// run, run[2] = its type, so they hit it or pass close by. the others
+// go anywhere into the cube. one ray in four starts far out where the
+// roots are least precise, the directions are not unit ones
+static void	random_ray(t_trace *tr, t_map *map, unsigned int *seed, int *run)
+{
+	t_aabb		*box;
+	t_float_3	aim;
+	float		r;
+
+	box = map->sp.box + run[0] + (int)rnd(seed, 0, run[1]);
+	if (run[2] == CYLINDER)
+		box = map->cy.box + run[0] + (int)rnd(seed, 0, run[1]);
+	aim = (t_float_3){rnd(seed, box->min.x, box->max.x),
+		rnd(seed, box->min.y, box->max.y), rnd(seed, box->min.z, box->max.z)};
+	if (rnd(seed, 0, 4) < 1.0f)
+		aim = (t_float_3){rnd(seed, -30, 30), rnd(seed, -30, 30),
+			rnd(seed, -30, 30)};
+	r = 40.0f;
+	if (rnd(seed, 0, 4) < 1.0f)
+		r = 3000.0f;
+	tr->ray.orig = (t_float_3){rnd(seed, -r, r), rnd(seed, -r, r),
+		rnd(seed, -r, r)};
+	tr->ray.dir = vec_sub(aim, tr->ray.orig);
+	tr->ray.dir = vec_mul(vec_normalize(tr->ray.dir), rnd(seed, 0.5f, 2.0f));
+	tr->hit_id = -1;
+	tr->t = INFINITY;
+}
+
+// the kernel result against the scalar test of every object of the run
+// on a random ray, both must hit the same object or both miss, and agree
+// on the distance within the shadow bias. 1 on a mismatch
+static int	check_run(t_map *map, unsigned int *seed, int *run)
+{
+	t_trace	kernel;
+	t_trace	ref;
+	float	t;
+	int		i;
+
+	random_ray(&kernel, map, seed, run);
+	ref = kernel;
+	t = INFINITY;
+	i = -1;
+	while (++i < run[1])
+	{
+		if (run[2] == SPHERE && sphere_intersect(ref.ray, &map->sp,
+				run[0] + i, &t) && t < ref.t)
+			record_hit(&ref, ((run[0] + i) << OBJ_TYPE_BITS) | SPHERE, t);
+		if (run[2] == CYLINDER && cylinder_intersect(ref.ray, &map->cy,
+				run[0] + i, &t) && t < ref.t)
+			record_hit(&ref, ((run[0] + i) << OBJ_TYPE_BITS) | CYLINDER, t);
+	}
+	if (run[2] == SPHERE)
+		map->sp.nearest(&map->sp, run[0], run[1], &kernel);
+	else
+		cylinders_nearest(&map->cy, run[0], run[1], &kernel);
+	return (kernel.hit_id != ref.hit_id || (ref.hit_id >= 0
+			&& fabsf(kernel.t - ref.t) > SHADOW_BIAS * (1.0f + ref.t)));
+}
+
+// the sse and the avx2 sphere kernels and the cylinder kernel against
+// sphere_intersect() and cylinder_intersect() on fuzzed rays and runs of
+// 1 to 8 objects
+int	main(void)
+{
+	unsigned int	seed;
+	t_map			*map;
+	int				run[3];
+	int				bad[2];
+	int				k;
+
+	seed = 2463534242u;
+	map = fill(&seed);
+	ft_bzero(bad, sizeof(bad));
+	k = -1;
+	while (++k < TEST_RAYS)
+	{
+		run[1] = 1 + k % 8;
+		run[0] = (int)rnd(&seed, 0, TEST_OBJECTS - run[1]);
+		run[2] = SPHERE;
+		map->sp.nearest = spheres_nearest4;
+		bad[0] += check_run(map, &seed, run);
+		map->sp.nearest = sphere_kernel();
+		bad[0] += check_run(map, &seed, run);
+		run[2] = CYLINDER;
+		bad[1] += check_run(map, &seed, run);
+	}
+	printf("mismatches: spheres %d, cylinders %d\n", bad[0], bad[1]);
+	free_map(map);
+	return (bad[0] || bad[1]);
+}
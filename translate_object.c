@@ -6,60 +6,52 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/09/12 17:50:26 by khlavaty          #+#    #+#             */
-/*   Updated: 2024/09/12 18:04:42 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:52:48 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
-void	translate_object(t_obj *obj, float translation, char axis)
+static void	shift(float *coord, int count, float translation)
 {
-	if (axis == 'x')
-		translate_object_x(obj, translation);
-	else if (axis == 'y')
-		translate_object_y(obj, translation);
-	else if (axis == 'z')
-		translate_object_z(obj, translation);
+	int	i;
+
+	i = 0;
+	while (i < count)
+		coord[i++] += translation;
 }
 
-void	translate_object_x(t_obj *obj, float translation)
+void	translate_object_x(t_map *map, float translation)
 {
-	if (obj->type == SPHERE)
-		((t_sp *)obj->object)->pos.x += translation;
-	else if (obj->type == PLANE)
-		((t_pl *)obj->object)->pos.x += translation;
-	else if (obj->type == CYLINDER)
-		((t_cy *)obj->object)->pos.x += translation;
+	shift(map->sp.x, map->sp.count, translation);
+	shift(map->pl.x, map->pl.count, translation);
+	shift(map->cy.x, map->cy.count, translation);
 }
 
-void	translate_object_y(t_obj *obj, float translation)
+void	translate_object_y(t_map *map, float translation)
 {
-	if (obj->type == SPHERE)
-		((t_sp *)obj->object)->pos.y += translation;
-	else if (obj->type == PLANE)
-		((t_pl *)obj->object)->pos.y += translation;
-	else if (obj->type == CYLINDER)
-		((t_cy *)obj->object)->pos.y += translation;
+	shift(map->sp.y, map->sp.count, translation);
+	shift(map->pl.y, map->pl.count, translation);
+	shift(map->cy.y, map->cy.count, translation);
 }
 
-void	translate_object_z(t_obj *obj, float translation)
+void	translate_object_z(t_map *map, float translation)
 {
-	if (obj->type == SPHERE)
-		((t_sp *)obj->object)->pos.z += translation;
-	else if (obj->type == PLANE)
-		((t_pl *)obj->object)->pos.z += translation;
-	else if (obj->type == CYLINDER)
-		((t_cy *)obj->object)->pos.z += translation;
+	shift(map->sp.z, map->sp.count, translation);
+	shift(map->pl.z, map->pl.count, translation);
+	shift(map->cy.z, map->cy.count, translation);
 }
 
+// every object moves, one coordinate array at a time
 void	translate_objects(t_win *win, float translation, char axis)
 {
-	t_obj	*obj;
-
-	obj = win->map->objects;
-	while (obj)
-	{
-		translate_object(obj, translation, axis);
-		obj = obj->next;
-	}
+	if (axis == 'x')
+		translate_object_x(win->map, translation);
+	else if (axis == 'y')
+		translate_object_y(win->map, translation);
+	else if (axis == 'z')
+		translate_object_z(win->map, translation);
+	scene_prepare(win->map, OBJ_ALL_TYPES);
+	win->map->version++;
+	win->map->shape_dirty |= (1 << SPHERE) | (1 << CYLINDER);
 }
@@ -6,26 +6,12 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/08/20 18:21:06 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/12 21:14:32 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:08:58 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
-int	add_colors(int col1, int col2)
-{
-	t_int_3	rgb1;
-	t_int_3	rgb2;
-	t_int_3	ret;
-
-	rgb1 = extract_rgb(col1);
-	rgb2 = extract_rgb(col2);
-	ret.x = clamp(rgb1.x + rgb2.x, 0, 255);
-	ret.y = clamp(rgb1.y + rgb2.y, 0, 255);
-	ret.z = clamp(rgb1.z + rgb2.z, 0, 255);
-	return (create_color(ret.x, ret.y, ret.z));
-}
-
 int	clamp(int value, int min, int max)
 {
 	if (value < min)
@@ -35,19 +21,55 @@ int	clamp(int value, int min, int max)
 	return (value);
 }
 
-int	color_multiply(int color, float ratio)
+// srgb transfer function both ways, to_srgb is indexed by the linear
+// value scaled to SRGB_LUT_SIZE - 1, fine enough that every 8 bit color
+// survives decoding and encoding again
+void	color_init(t_win *win)
 {
-	t_int_3	rgb;
-	int		r;
-	int		g;
-	int		b;
+	float	v;
+	int		i;
 
-	rgb = extract_rgb(color);
-	r = (int)(rgb.x * ratio);
-	r = clamp(r, 0, 255);
-	g = (int)(rgb.y * ratio);
-	g = clamp(g, 0, 255);
-	b = (int)(rgb.z * ratio);
-	b = clamp(b, 0, 255);
-	return (rgb_to_hex(r, g, b));
+	i = -1;
+	while (++i < 256)
+	{
+		v = i / 255.0f;
+		if (v <= 0.04045f)
+			win->to_linear[i] = v / 12.92f;
+		else
+			win->to_linear[i] = powf((v + 0.055f) / 1.055f, 2.4f);
+	}
+	i = -1;
+	while (++i < SRGB_LUT_SIZE)
+	{
+		v = i / (float)(SRGB_LUT_SIZE - 1);
+		if (v <= 0.0031308f)
+			v = v * 12.92f;
+		else
+			v = 1.055f * powf(v, 1.0f / 2.4f) - 0.055f;
+		win->to_srgb[i] = (unsigned char)(v * 255.0f + 0.5f);
+	}
+}
+
+// packed srgb color to linear rgb, the last lane is unused
+t_v4	color_decode(t_win *win, int col)
+{
+	return ((t_v4){win->to_linear[(col >> 16) & 0xFF],
+		win->to_linear[(col >> 8) & 0xFF], win->to_linear[col & 0xFF], 0.0f});
+}
+
+// linear value clipped to 0 .. 1 and quantized through the srgb table
+static int	srgb_channel(t_win *win, float v)
+{
+	if (!(v > 0.0f))
+		return (0);
+	if (v >= 1.0f)
+		return (win->to_srgb[SRGB_LUT_SIZE - 1]);
+	return (win->to_srgb[(int)(v * (SRGB_LUT_SIZE - 1) + 0.5f)]);
+}
+
+// linear rgb to a packed srgb color, the one quantization of a pixel
+int	color_encode(t_win *win, t_v4 rgb)
+{
+	return ((srgb_channel(win, rgb[0]) << 16)
+		| (srgb_channel(win, rgb[1]) << 8) | srgb_channel(win, rgb[2]));
 }
@@ -6,7 +6,7 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/02/26 13:22:04 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/12 21:09:15 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:54:25 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,31 +20,22 @@ t_map	*malloc_map(void)
 	if (!map)
 		error_throw("Cannot allocate memory for map");
 	ft_bzero(map, sizeof(t_map));
-	map->objects = NULL;
 	map->vec_up = (t_float_3){0, 0, 0};
 	map->vec_right = (t_float_3){0, 0, 0};
 	map->aspect_ratio = 0.0f;
 	map->height = 0.0f;
 	map->width = 0.0f;
+	map->version = 1;
+	map->sp.nearest = sphere_kernel();
 	return (map);
 }
 
-void	free_objects(t_obj *objects)
+void	free_map(t_map *map)
 {
-	t_obj	*temp;
-
-	while (objects)
-	{
-		temp = objects;
-		if (temp->type == SPHERE)
-			free((t_sp *)temp->object);
-		else if (temp->type == PLANE)
-			free((t_pl *)temp->object);
-		else if (temp->type == CYLINDER)
-			free((t_cy *)temp->object);
-		objects = objects->next;
-		free(temp);
-	}
+	scene_free(map);
+	bvh_flat_free(map);
+	free(map->bounded);
+	free(map);
 }
 
 int	error_throw(char *msg)
@@ -6,7 +6,7 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/02/26 12:48:04 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/12 20:59:33 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:31:47 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -34,16 +34,3 @@ int	is_rt_file(char *filename)
 		return (ft_strncmp(filename + len, ".rt", 3) == 0);
 	return (0);
 }
-
-void	add_object(t_map *map, t_obj_type type, void *object, int col)
-{
-	t_obj	*new_obj;
-
-	new_obj = malloc(sizeof(t_obj));
-	new_obj->type = type;
-	new_obj->object = object;
-	new_obj->color = col;
-	new_obj->next = map->objects;
-	new_obj->id = rand();
-	map->objects = new_obj;
-}
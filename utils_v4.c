@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   utils_v4.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:12:12 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 15:01:12 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// lane wise fminf / fmaxf, a nan in b gives a like the libm versions
+t_v4	v4_min(t_v4 a, t_v4 b)
+{
+	t_m4	take_a;
+
+	take_a = (a < b) | (b != b);
+	return ((t_v4)(((t_m4)a & take_a) | ((t_m4)b & ~take_a)));
+}
+
+t_v4	v4_max(t_v4 a, t_v4 b)
+{
+	t_m4	take_a;
+
+	take_a = (a > b) | (b != b);
+	return ((t_v4)(((t_m4)a & take_a) | ((t_m4)b & ~take_a)));
+}
+
+// fminf / fmaxf without the libm call, which they stay without
+// -ffinite-math-only, same nan handling as v4_min()
+float	f_min(float a, float b)
+{
+	if (a < b || b != b)
+		return (a);
+	return (b);
+}
+
+float	f_max(float a, float b)
+{
+	if (a > b || b != b)
+		return (a);
+	return (b);
+}
+
+// squared length of u - v * k per lane, what is left of u across v for
+// k = u.v / v.v, in the order of the steps of quad_roots()
+t_v4	v4_reject2(t_v4 *u, t_v4 *v, t_v4 k)
+{
+	t_v4	f[3];
+
+	f[0] = u[0] - v[0] * k;
+	f[1] = u[1] - v[1] * k;
+	f[2] = u[2] - v[2] * k;
+	return (v4_dot(f, f));
+}
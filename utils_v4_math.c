@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   utils_v4_math.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:27:05 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 14:27:05 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+#ifdef __SSE__
+
+// lane wise sqrtf
+t_v4	v4_sqrt(t_v4 v)
+{
+	return ((t_v4)_mm_sqrt_ps((__m128)v));
+}
+#else
+
+t_v4	v4_sqrt(t_v4 v)
+{
+	int	k;
+
+	k = -1;
+	while (++k < 4)
+		v[k] = sqrtf(v[k]);
+	return (v);
+}
+#endif
+
+// vec_dot() of 4 vectors at once, one per lane of the 3 components
+t_v4	v4_dot(t_v4 *u, t_v4 *v)
+{
+	return (u[0] * v[0] + u[1] * v[1] + u[2] * v[2]);
+}
+
+// vec_cross() of 4 vectors at once into res
+void	v4_cross(t_v4 *res, t_v4 *u, t_v4 *v)
+{
+	res[0] = u[1] * v[2] - u[2] * v[1];
+	res[1] = u[2] * v[0] - u[0] * v[2];
+	res[2] = u[0] * v[1] - u[1] * v[0];
+}
+
+// a where m is set, b elsewhere
+t_v4	v4_select(t_m4 m, t_v4 a, t_v4 b)
+{
+	return ((t_v4)(((t_m4)a & m) | ((t_m4)b & ~m)));
+}
@@ -6,7 +6,7 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/13 15:48:39 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/12 20:54:12 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:18:40 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,15 +21,15 @@ float	vec_dot(t_float_3 a, t_float_3 b)
 }
 
 // normalizes a vector
-// division of its components by its magnitude
+// multiplication of its components by one over its magnitude
 t_float_3	vec_normalize(t_float_3 v)
 {
-	float	length;
+	float	inv;
 
-	length = vec_length(v);
-	v.x /= length;
-	v.y /= length;
-	v.z /= length;
+	inv = inv_sqrt(vec_dot(v, v));
+	v.x *= inv;
+	v.y *= inv;
+	v.z *= inv;
 	return (v);
 }
 
@@ -52,10 +52,5 @@ int	is_zero_vector(t_float_3 vec)
 
 float	vec_cos(t_float_3 a, t_float_3 b)
 {
-	float	dot;
-	float	t;
-
-	dot = vec_dot(a, b);
-	t = vec_length(a) * vec_length(b);
-	return (dot / t);
+	return (vec_dot(a, b) * inv_sqrt(vec_dot(a, a) * vec_dot(b, b)));
 }
@@ -6,7 +6,7 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/09/09 12:32:17 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/12 20:52:28 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:20:17 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -27,3 +27,32 @@ float	vec_length(t_float_3 vec)
 {
 	return (sqrtf(vec.x * vec.x + vec.y * vec.y + vec.z * vec.z));
 }
+
+#ifdef __SSE__
+
+// 1 / sqrt(x) from the sse estimate refined by one newton step,
+// about 22 good bits instead of a square root and a division
+float	inv_sqrt(float x)
+{
+	float	y;
+
+	y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+	return (y * (1.5f - 0.5f * x * y * y));
+}
+#else
+
+float	inv_sqrt(float x)
+{
+	return (1.0f / sqrtf(x));
+}
+#endif
+
+// component of v along axis 0 = x, 1 = y, 2 = z
+float	axis_value(t_float_3 v, int axis)
+{
+	if (axis == 0)
+		return (v.x);
+	if (axis == 1)
+		return (v.y);
+	return (v.z);
+}
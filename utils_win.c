@@ -6,27 +6,30 @@
 /*   By: khlavaty <khlavaty@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/06/27 13:05:14 by fvonsovs          #+#    #+#             */
-/*   Updated: 2024/09/12 20:50:29 by khlavaty         ###   ########.fr       */
+/*   Updated: 2026/10/18 18:36:44 by fvonsovs         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt.h"
 
-// big endian, MSB is the leftmost bit
-// little endian, LSB is the leftmost bit
+// one pixel through the row writer of the image format
 void	pixel_to_img(t_win *win, int x, int y, int color)
 {
-	char	*pixel;
-	int		i;
+	win->put_row(win, win->addr[win->back] + y * win->line_l
+		+ x * (win->bpp / 8), &color, 1);
+}
 
-	i = win->bpp - 8;
-	pixel = win->addr + (y * win->line_l + x * (win->bpp / 8));
-	while (i >= 0)
-	{
-		if (win->endian != 0)
-			*pixel++ = (color >> i) & 0xFF;
-		else
-			*pixel++ = (color >> (win->bpp - 8 - i)) & 0xFF;
-		i -= 8;
-	}
+// --output: the frame goes into plain memory laid out like a 32 bit mlx
+// image, nothing talks to the display
+void	headless_init(t_win *win)
+{
+	win->bpp = 32;
+	win->line_l = WINDOW_WIDTH * 4;
+	win->endian = (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__);
+	win->addr[0] = malloc((size_t)win->line_l * WINDOW_HEIGHT);
+	if (!win->addr[0])
+		error_throw("Cannot allocate the frame buffer");
+	win->addr[1] = win->addr[0];
+	win->put_row = row_writer(win);
+	color_init(win);
 }
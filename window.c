@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   window.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:31:02 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:36:44 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// opens the window and the two images the frames are traced into,
+// with the writer and color tables used to fill them
+void	window_init(t_win *win)
+{
+	int	i;
+
+	win->mlx = mlx_init();
+	if (!win->mlx)
+		error_throw("Cannot connect to the display");
+	win->win = mlx_new_window(win->mlx, WINDOW_WIDTH, WINDOW_HEIGHT, \
+	"miniRT");
+	i = 0;
+	while (i < 2)
+	{
+		win->img[i] = mlx_new_image(win->mlx, WINDOW_WIDTH, WINDOW_HEIGHT);
+		if (!win->img[i])
+			error_throw("Cannot create image");
+		win->addr[i] = mlx_get_data_addr(win->img[i], &win->bpp, \
+		&win->line_l, &win->endian);
+		i++;
+	}
+	win->put_row = row_writer(win);
+	color_init(win);
+}
+
+// puts the last finished frame back after the window got uncovered
+int	handle_expose(t_win *win)
+{
+	mlx_put_image_to_window(win->mlx, win->win, win->img[!win->back], 0, 0);
+	return (0);
+}
+
+// shows the finished back buffer, see render_collect()
+void	window_present(t_win *win)
+{
+	mlx_put_image_to_window(win->mlx, win->win, win->img[win->back], 0, 0);
+}
+
+void	run_window(t_win *win)
+{
+	mlx_loop_hook(win->mlx, render, win);
+	mlx_hook(win->win, 2, 1L << 0, handle_keypress, win);
+	mlx_hook(win->win, 17, 0, handle_destroy_notify, win);
+	mlx_hook(win->win, 12, 1L << 15, handle_expose, win);
+	mlx_loop(win->mlx);
+}
@@ -0,0 +1,31 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   window_headless.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fvonsovs <fvonsovs@student.42prague.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:40:15 by fvonsovs          #+#    #+#             */
+/*   Updated: 2026/10/18 18:40:15 by fvonsovs         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// the window of make headless, built without minilibx and X, only
+// --output renders
+void	window_init(t_win *win)
+{
+	(void)win;
+	error_throw("Built without a window, render with --output FILE");
+}
+
+void	window_present(t_win *win)
+{
+	(void)win;
+}
+
+void	run_window(t_win *win)
+{
+	(void)win;
+}